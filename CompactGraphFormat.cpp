@@ -0,0 +1,142 @@
+/**
+* @file CompactGraphFormat.cpp
+* @authors
+*   Francisco Eduardo Fontenele - 15452569
+*   Vinicius Botte - 15522900
+*
+* \brief Implementação do formato compacto com dicionário de chaves e varints.
+*
+* \details Laços se auto-arestas (raras) aparecem duas vezes na lista do vértice e são gravados uma vez.
+*
+* \pre Snapshot consistente; qualquer numeração de ids é aceita.
+* \post Codificação/decodificação em O(V + E log d).
+*/
+
+#include "CompactGraphFormat.h"
+#include <algorithm>
+using namespace std;
+
+static void putVarint(vector<uint8_t>& out, uint64_t v) {
+    while (v >= 0x80) {
+        out.push_back(static_cast<uint8_t>(v | 0x80));
+        v >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(v));
+}
+
+static bool getVarint(const uint8_t*& p, const uint8_t* end, uint64_t& v) {
+    v = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (p == end) return false;
+        uint8_t b = *p++;
+        v |= static_cast<uint64_t>(b & 0x7F) << shift;
+        if (!(b & 0x80)) return true;
+    }
+    return false;
+}
+
+static uint64_t zigzag(int v) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(v)) << 1) ^ static_cast<uint64_t>(static_cast<int64_t>(v) >> 63);
+}
+
+static int unzigzag(uint64_t v) {
+    return static_cast<int>(static_cast<int64_t>(v >> 1) ^ -static_cast<int64_t>(v & 1));
+}
+
+void CompactGraphFormat::encode(const GraphSnapshot& snap, vector<uint8_t>& out) {
+    int n = snap.vertexCount();
+    putVarint(out, static_cast<uint64_t>(n));
+
+    const string* prev = nullptr;
+    for (int u = 0; u < n; ++u) {
+        const string& k = snap.keyOf(u);
+        size_t shared = 0;
+        if (prev) {
+            size_t lim = min(prev->size(), k.size());
+            while (shared < lim && (*prev)[shared] == k[shared]) ++shared;
+        }
+        putVarint(out, shared);
+        putVarint(out, k.size() - shared);
+        out.insert(out.end(), k.begin() + static_cast<ptrdiff_t>(shared), k.end());
+        prev = &k;
+    }
+
+    const auto& ids = snap.neighborIds();
+    const auto& costs = snap.neighborCosts();
+    vector<pair<int, int>> row;
+    for (int u = 0; u < n; ++u) {
+        row.clear();
+        bool skipLoop = false;
+        for (int i = snap.begin(u); i < snap.end(u); ++i) {
+            if (ids[i] < u) continue;
+            if (ids[i] == u) {
+                skipLoop = !skipLoop;
+                if (!skipLoop) continue;
+            }
+            row.emplace_back(ids[i], costs[i]);
+        }
+        sort(row.begin(), row.end());
+        putVarint(out, row.size());
+        int last = u;
+        for (const auto& p : row) {
+            putVarint(out, static_cast<uint64_t>(p.first - last));
+            putVarint(out, zigzag(p.second));
+            last = p.first;
+        }
+    }
+}
+
+bool CompactGraphFormat::decode(const uint8_t* data, size_t n, map<string, list<pair<string, int>>>& out) {
+    out.clear();
+    const uint8_t* p = data;
+    const uint8_t* end = data + n;
+    uint64_t count = 0;
+    if (!getVarint(p, end, count) || count > n) return false;
+
+    vector<string> keys;
+    keys.reserve(static_cast<size_t>(count));
+    for (uint64_t i = 0; i < count; ++i) {
+        uint64_t shared = 0, suffix = 0;
+        if (!getVarint(p, end, shared) || !getVarint(p, end, suffix)) { out.clear(); return false; }
+        if (i == 0 ? shared != 0 : shared > keys.back().size()) { out.clear(); return false; }
+        if (suffix > static_cast<uint64_t>(end - p)) { out.clear(); return false; }
+        string k = i == 0 ? string() : keys.back().substr(0, static_cast<size_t>(shared));
+        k.append(reinterpret_cast<const char*>(p), static_cast<size_t>(suffix));
+        p += suffix;
+        keys.push_back(std::move(k));
+    }
+
+    vector<list<pair<string, int>>*> rows;
+    rows.reserve(keys.size());
+    for (const auto& k : keys) rows.push_back(&out[k]);
+    if (out.size() != keys.size()) { out.clear(); return false; }
+
+    for (size_t u = 0; u < keys.size(); ++u) {
+        uint64_t degree = 0;
+        if (!getVarint(p, end, degree)) { out.clear(); return false; }
+        uint64_t v = u;
+        for (uint64_t j = 0; j < degree; ++j) {
+            uint64_t delta = 0, w = 0;
+            if (!getVarint(p, end, delta) || !getVarint(p, end, w)) { out.clear(); return false; }
+            v += delta;
+            if (v >= keys.size()) { out.clear(); return false; }
+            int cost = unzigzag(w);
+            rows[u]->emplace_back(keys[static_cast<size_t>(v)], cost);
+            rows[static_cast<size_t>(v)]->emplace_back(keys[u], cost);
+        }
+    }
+    if (p != end) { out.clear(); return false; }
+    return true;
+}
+
+size_t CompactGraphFormat::sizeV1(const GraphSnapshot& snap) {
+    size_t total = 3 * sizeof(int);
+    const auto& ids = snap.neighborIds();
+    for (int u = 0; u < snap.vertexCount(); ++u) {
+        total += 2 * sizeof(int) + snap.keyOf(u).size();
+        for (int i = snap.begin(u); i < snap.end(u); ++i) {
+            total += 2 * sizeof(int) + snap.keyOf(ids[i]).size();
+        }
+    }
+    return total;
+}
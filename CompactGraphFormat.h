@@ -0,0 +1,56 @@
+/**
+* @file CompactGraphFormat.h
+* @authors
+*   Francisco Eduardo Fontenele - 15452569
+*   Vinicius Botte - 15522900
+*
+* \brief Formato binário compacto (versão 2) para persistência do grafo.
+*
+* \details Após o cabeçalho comum (`int MAGIC`, `int VERSION = 2`), todos os inteiros são varints:
+*            n
+*            dicionário de chaves na ordem dos ids do snapshot (ordem de chave, salvo renumeração),
+*            cada uma como (prefixo comum com a anterior, tamanho do sufixo, bytes do sufixo)
+*            para cada vértice u: quantidade de vizinhos v >= u, seguida de pares
+*            (delta do id do vizinho, custo em zigzag), com vizinhos em ordem crescente
+*          Cada aresta não-direcionada é gravada uma única vez, referenciando ids em vez de chaves.
+*
+* \pre O snapshot deve refletir o estado a ser persistido.
+* \post Decodificação reconstrói a lista de adjacência com vizinhos em ordem de id.
+*/
+
+#ifndef COMPACT_GRAPH_FORMAT_H
+#define COMPACT_GRAPH_FORMAT_H
+
+#include <cstdint>
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+#include "GraphSnapshot.h"
+using namespace std;
+
+class CompactGraphFormat {
+public:
+    /**
+     * \brief Codifica o corpo (após o cabeçalho) no formato versão 2.
+     * \pre Nenhuma.
+     * \post `out` recebe os bytes do corpo.
+     */
+    static void encode(const GraphSnapshot& snap, vector<uint8_t>& out);
+
+    /**
+     * \brief Decodifica o corpo da versão 2.
+     * \pre `[data, data + n)` deve conter exatamente o corpo gravado por `encode`.
+     * \post Retorna falso (e `out` vazio) se os dados estiverem truncados ou inconsistentes.
+     */
+    static bool decode(const uint8_t* data, size_t n, map<string, list<pair<string, int>>>& out);
+
+    /**
+     * \brief Tamanho em bytes que o snapshot ocupa no formato versão 1.
+     * \pre Nenhuma.
+     * \post Retorna o tamanho exato do arquivo v1, incluindo cabeçalho.
+     */
+    static size_t sizeV1(const GraphSnapshot& snap);
+};
+
+#endif
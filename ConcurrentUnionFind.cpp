@@ -0,0 +1,64 @@
+/**
+* @file ConcurrentUnionFind.cpp
+* @authors
+*   Francisco Eduardo Fontenele - 15452569
+*   Vinicius Botte - 15522900
+*
+* \brief Implementação do Union-Find sem travas.
+*
+* \details Um id só deixa de ser raiz por um CAS bem-sucedido em `unite`; depois disso seu pai só
+*          muda para um ancestral (path splitting), então os ponteiros sempre sobem na árvore e
+*          `find` termina em número limitado de passos.
+*
+* \pre Nenhuma.
+* \post Estrutura segura para acesso concorrente.
+*/
+
+#include "ConcurrentUnionFind.h"
+using namespace std;
+
+ConcurrentUnionFind::ConcurrentUnionFind(int count)
+    : parent(new atomic<int>[static_cast<size_t>(count > 0 ? count : 0)]), n(count > 0 ? count : 0), components(n) {
+    for (int i = 0; i < n; ++i) parent[i].store(i, memory_order_relaxed);
+}
+
+int ConcurrentUnionFind::find(int x) const {
+    while (true) {
+        int p = parent[x].load(memory_order_acquire);
+        if (p == x) return x;
+        int gp = parent[p].load(memory_order_acquire);
+        if (gp != p) {
+            // Falha significa que outra thread já avançou o ponteiro; basta seguir.
+            parent[x].compare_exchange_weak(p, gp, memory_order_release, memory_order_relaxed);
+        }
+        x = gp;
+    }
+}
+
+bool ConcurrentUnionFind::unite(int a, int b) {
+    while (true) {
+        int ra = find(a);
+        int rb = find(b);
+        if (ra == rb) return false;
+        if (priority(ra) > priority(rb)) {
+            int t = ra;
+            ra = rb;
+            rb = t;
+        }
+        int expected = ra;
+        if (parent[ra].compare_exchange_strong(expected, rb, memory_order_acq_rel, memory_order_acquire)) {
+            components.fetch_sub(1, memory_order_acq_rel);
+            return true;
+        }
+    }
+}
+
+bool ConcurrentUnionFind::sameSet(int a, int b) const {
+    while (true) {
+        int ra = find(a);
+        int rb = find(b);
+        if (ra == rb) return true;
+        // Se `ra` continua raiz, houve um instante em que `a` e `b` estavam separados.
+        if (parent[ra].load(memory_order_acquire) == ra) return false;
+    }
+}
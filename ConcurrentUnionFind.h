@@ -0,0 +1,88 @@
+/**
+* @file ConcurrentUnionFind.h
+* @authors
+*   Francisco Eduardo Fontenele - 15452569
+*   Vinicius Botte - 15522900
+*
+* \brief Union-Find sem travas para consultas de conectividade a partir de várias threads.
+*
+* \details Os pais ficam em um vetor de `atomic<int>`. `unite` liga raízes com compare-and-swap
+*          (a raiz de menor prioridade passa a apontar para a de maior, prioridade = hash fixo do
+*          id, o que mantém as árvores rasas sem guardar rank). `find` nunca espera: faz
+*          *path splitting* com CAS oportunista, cuja falha apenas deixa de compactar.
+*          `sameSet` repete a busca até confirmar que a raiz encontrada ainda é raiz, o que torna
+*          a resposta linearizável mesmo com uniões concorrentes.
+*
+* \pre Número de elementos fixo na construção; ids em [0, size()).
+* \post `find`, `unite` e `sameSet` podem ser chamados concorrentemente por qualquer número de threads.
+*/
+
+#ifndef CONCURRENT_UNION_FIND_H
+#define CONCURRENT_UNION_FIND_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+using namespace std;
+
+class ConcurrentUnionFind {
+private:
+    unique_ptr<atomic<int>[]> parent;
+    int n;
+    atomic<int> components;
+
+    /**
+     * \brief Prioridade de ligação do id (bijeção em 32 bits, sem empates).
+     * \pre Nenhuma.
+     * \post Valor fixo por id.
+     */
+    static uint32_t priority(int x) { return static_cast<uint32_t>(x) * 0x9E3779B1u; }
+
+public:
+    /**
+     * \brief Cria `count` conjuntos unitários.
+     * \pre `count >= 0`.
+     * \post Cada id é raiz do próprio conjunto.
+     */
+    explicit ConcurrentUnionFind(int count);
+
+    ConcurrentUnionFind(const ConcurrentUnionFind&) = delete;
+    ConcurrentUnionFind& operator=(const ConcurrentUnionFind&) = delete;
+
+    /**
+     * \brief Raiz atual do conjunto de `x`.
+     * \pre `0 <= x < size()`.
+     * \post Compacta o caminho percorrido; com uniões concorrentes a raiz pode deixar de sê-lo logo após.
+     */
+    int find(int x) const;
+
+    /**
+     * \brief Une os conjuntos de `a` e `b`.
+     * \pre Ids válidos.
+     * \post Retorna verdadeiro se esta chamada fez a ligação (exatamente uma chamada por fusão).
+     */
+    bool unite(int a, int b);
+
+    /**
+     * \brief Verifica se `a` e `b` estão no mesmo conjunto.
+     * \pre Ids válidos.
+     * \post Resposta linearizável em relação às chamadas de `unite`.
+     */
+    bool sameSet(int a, int b) const;
+
+    /**
+     * \brief Número de conjuntos disjuntos.
+     * \pre Nenhuma.
+     * \post Exato quando não há uniões em andamento.
+     */
+    int componentCount() const { return components.load(memory_order_acquire); }
+
+    /**
+     * \brief Número de elementos.
+     * \pre Nenhuma.
+     * \post Retorna o tamanho fixado na construção.
+     */
+    int size() const { return n; }
+};
+
+#endif
@@ -0,0 +1,291 @@
+/**
+* @file GeometricMST.cpp
+* @authors
+*   Francisco Eduardo Fontenele - 15452569
+*   Vinicius Botte - 15522900
+*
+* \brief Implementação da MST euclidiana (Borůvka com k-d tree seguido de Kruskal).
+*
+* \details Os pontos são guardados na ordem das folhas da k-d tree, de modo que pontos próximos
+*          fiquem próximos na memória. A cada rodada o rótulo de componente de cada nó é recalculado
+*          de baixo para cima (-1 quando misto). A busca de cada ponto começa com o melhor resultado
+*          já conhecido do seu componente, o que poda a maior parte da árvore.
+*
+* \pre Nenhuma.
+* \post Nenhuma.
+*/
+
+#include "GeometricMST.h"
+#include "ConcurrentUnionFind.h"
+#include "KruskalMST.h"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <utility>
+using namespace std;
+
+/** \brief Pontos por folha da k-d tree. */
+static constexpr int LEAF_SIZE = 8;
+
+/** \brief Nó da k-d tree: caixa envolvente, faixa [lo, hi) de pontos na ordem da árvore e ligações. */
+struct KdNode {
+    double minX, maxX, minY, maxY;
+    int lo, hi;
+    int left, right, up;
+};
+
+/** \brief Aresta candidata entre posições da árvore; a ordem (d2, lo, hi) é total. */
+struct Candidate {
+    double d2;
+    int lo, hi;
+
+    bool operator<(const Candidate& o) const {
+        if (d2 != o.d2) return d2 < o.d2;
+        if (lo != o.lo) return lo < o.lo;
+        return hi < o.hi;
+    }
+};
+
+/** \brief Ponto copiado para a construção da árvore (`site` indexa os sítios distintos). */
+struct KdPoint {
+    double x, y;
+    int site;
+};
+
+/**
+ * \brief Constrói a subárvore sobre `pts[lo, hi)`, dividindo a maior dimensão pela mediana.
+ * \pre Nenhuma.
+ * \post Retorna o índice do nó criado em `nodes` (pré-ordem: filhos depois do pai); `pts` fica na
+ *       ordem das folhas.
+ */
+static int buildKd(vector<KdNode>& nodes, vector<KdPoint>& pts, int lo, int hi, int up) {
+    int id = static_cast<int>(nodes.size());
+    double minX = numeric_limits<double>::infinity(), maxX = -minX, minY = minX, maxY = -minX;
+    for (int i = lo; i < hi; ++i) {
+        minX = min(minX, pts[i].x); maxX = max(maxX, pts[i].x);
+        minY = min(minY, pts[i].y); maxY = max(maxY, pts[i].y);
+    }
+    nodes.push_back({minX, maxX, minY, maxY, lo, hi, -1, -1, up});
+    if (hi - lo <= LEAF_SIZE) return id;
+
+    bool splitX = (maxX - minX) >= (maxY - minY);
+    int mid = lo + (hi - lo) / 2;
+    nth_element(pts.begin() + lo, pts.begin() + mid, pts.begin() + hi, [splitX](const KdPoint& a, const KdPoint& b) {
+        return splitX ? a.x < b.x : a.y < b.y;
+    });
+    int l = buildKd(nodes, pts, lo, mid, id);
+    int r = buildKd(nodes, pts, mid, hi, id);
+    nodes[id].left = l;
+    nodes[id].right = r;
+    return id;
+}
+
+static double boxDistance2(const KdNode& n, double x, double y) {
+    double dx = x < n.minX ? n.minX - x : (x > n.maxX ? x - n.maxX : 0.0);
+    double dy = y < n.minY ? n.minY - y : (y > n.maxY ? y - n.maxY : 0.0);
+    return dx * dx + dy * dy;
+}
+
+/** \brief Distância arredondada; acima de `INT_MAX` devolve `INT_MAX + 1` (custo não representável). */
+static int64_t roundedCost(double d2) {
+    double d = nearbyint(sqrt(d2));
+    return d > static_cast<double>(INT_MAX) ? static_cast<int64_t>(INT_MAX) + 1 : static_cast<int64_t>(d);
+}
+
+bool GeometricMST::compute(const vector<SiteCoord>& sites,
+                           vector<Edge>& outMst,
+                           int& outTotalCost,
+                           GeometricStats* stats) {
+    outMst.clear();
+    outTotalCost = 0;
+    GeometricStats local;
+
+    // Sítios distintos por chave (a primeira ocorrência prevalece): ordena (hash, posição) e só
+    // compara chaves dentro de grupos de mesmo hash.
+    vector<pair<size_t, int>> hashed(sites.size());
+    for (size_t i = 0; i < sites.size(); ++i) hashed[i] = {hash<string_view>()(sites[i].key), static_cast<int>(i)};
+    sort(hashed.begin(), hashed.end());
+    vector<char> keep(sites.size(), 1);
+    for (size_t i = 0, j; i < hashed.size(); i = j) {
+        for (j = i + 1; j < hashed.size() && hashed[j].first == hashed[i].first; ++j) {
+            for (size_t k = i; k < j; ++k) {
+                if (keep[hashed[k].second] && sites[hashed[k].second].key == sites[hashed[j].second].key) {
+                    keep[hashed[j].second] = 0;
+                    ++local.duplicateKeys;
+                    break;
+                }
+            }
+        }
+    }
+    vector<pair<size_t, int>>().swap(hashed);
+    vector<const SiteCoord*> pts;
+    pts.reserve(sites.size());
+    for (size_t i = 0; i < sites.size(); ++i) {
+        if (keep[i]) pts.push_back(&sites[i]);
+    }
+    int n = static_cast<int>(pts.size());
+    if (n < 2) {
+        if (stats) *stats = local;
+        return true;
+    }
+
+    // Daqui em diante, ids são posições na ordem da árvore.
+    vector<KdPoint> tree(n);
+    for (int i = 0; i < n; ++i) tree[i] = {pts[i]->x, pts[i]->y, i};
+    vector<KdNode> nodes;
+    nodes.reserve(4 * (n / LEAF_SIZE + 1));
+    buildKd(nodes, tree, 0, n, -1);
+    vector<double> xs(n), ys(n);
+    vector<int> order(n);
+    for (int i = 0; i < n; ++i) {
+        xs[i] = tree[i].x;
+        ys[i] = tree[i].y;
+        order[i] = tree[i].site;
+    }
+    vector<KdPoint>().swap(tree);
+    vector<int> leafOf(n);
+    for (size_t k = 0; k < nodes.size(); ++k) {
+        if (nodes[k].left >= 0) continue;
+        for (int i = nodes[k].lo; i < nodes[k].hi; ++i) leafOf[i] = static_cast<int>(k);
+    }
+
+    const double INF = numeric_limits<double>::infinity();
+    ConcurrentUnionFind sets(n);
+    vector<int> comp(n);
+    vector<int> nodeComp(nodes.size());
+    vector<Candidate> best(n);
+    // Limite inferior da distância de cada ponto até fora do seu componente; só cresce com as fusões.
+    vector<double> reach(n, 0.0);
+    vector<Candidate> candidates;
+    candidates.reserve(2 * static_cast<size_t>(n));
+    vector<pair<int, double>> stack;
+
+    while (sets.componentCount() > 1) {
+        ++local.rounds;
+        for (int i = 0; i < n; ++i) comp[i] = sets.find(i);
+        for (size_t k = nodes.size(); k-- > 0;) {
+            const KdNode& nd = nodes[k];
+            if (nd.left < 0) {
+                int c = comp[nd.lo];
+                for (int i = nd.lo + 1; i < nd.hi && c >= 0; ++i) {
+                    if (comp[i] != c) c = -1;
+                }
+                nodeComp[k] = c;
+            } else {
+                nodeComp[k] = nodeComp[nd.left] == nodeComp[nd.right] ? nodeComp[nd.left] : -1;
+            }
+        }
+        fill(best.begin(), best.end(), Candidate{INF, INT_MAX, INT_MAX});
+        // Limites iniciais baratos: pares de componentes diferentes dentro da mesma folha.
+        for (size_t k = 0; k < nodes.size(); ++k) {
+            const KdNode& nd = nodes[k];
+            if (nd.left >= 0 || nodeComp[k] >= 0) continue;
+            for (int i = nd.lo; i < nd.hi; ++i) {
+                for (int q = i + 1; q < nd.hi; ++q) {
+                    if (comp[i] == comp[q]) continue;
+                    double dx = xs[q] - xs[i], dy = ys[q] - ys[i];
+                    Candidate cand{dx * dx + dy * dy, i, q};
+                    if (cand < best[comp[i]]) best[comp[i]] = cand;
+                    if (cand < best[comp[q]]) best[comp[q]] = cand;
+                }
+            }
+        }
+
+        for (int p = 0; p < n; ++p) {
+            int c = comp[p];
+            Candidate& cb = best[c];
+            if (reach[p] > cb.d2) continue;
+            double px = xs[p], py = ys[p];
+            Candidate start = cb;
+            // Busca de baixo para cima: a folha do ponto, depois a subárvore irmã de cada ancestral,
+            // até que a bola do melhor resultado caiba inteira no nó corrente.
+            int node = leafOf[p];
+            stack.assign(1, {node, 0.0});
+            while (true) {
+                while (!stack.empty()) {
+                    auto [id, boxD2] = stack.back();
+                    stack.pop_back();
+                    const KdNode& nd = nodes[id];
+                    if (boxD2 > cb.d2 || nodeComp[id] == c) continue;
+                    if (nd.left < 0) {
+                        for (int q = nd.lo; q < nd.hi; ++q) {
+                            if (comp[q] == c) continue;
+                            double dx = xs[q] - px, dy = ys[q] - py;
+                            Candidate cand{dx * dx + dy * dy, min(p, q), max(p, q)};
+                            if (cand < cb) cb = cand;
+                        }
+                        continue;
+                    }
+                    // O filho mais próximo sai primeiro da pilha para apertar o limite cedo.
+                    double dl = boxDistance2(nodes[nd.left], px, py);
+                    double dr = boxDistance2(nodes[nd.right], px, py);
+                    if (dl <= dr) {
+                        stack.push_back({nd.right, dr});
+                        stack.push_back({nd.left, dl});
+                    } else {
+                        stack.push_back({nd.left, dl});
+                        stack.push_back({nd.right, dr});
+                    }
+                }
+                const KdNode& nd = nodes[node];
+                if (nd.up < 0) break;
+                // Pontos fora da subárvore ficam fora do interior da caixa (cortes pela mediana).
+                double margin = min(min(px - nd.minX, nd.maxX - px), min(py - nd.minY, nd.maxY - py));
+                if (margin > 0 && margin * margin > cb.d2) break;
+                const KdNode& upNode = nodes[nd.up];
+                int sibling = upNode.left == node ? upNode.right : upNode.left;
+                stack.assign(1, {sibling, boxDistance2(nodes[sibling], px, py)});
+                node = nd.up;
+            }
+            reach[p] = cb < start ? cb.d2 : start.d2;
+        }
+
+        bool merged = false;
+        for (int i = 0; i < n; ++i) {
+            if (comp[i] != i || best[i].d2 == INF) continue;
+            candidates.push_back(best[i]);
+            merged |= sets.unite(best[i].lo, best[i].hi);
+        }
+        // Sem fusão a rodada seguinte seria idêntica: distâncias estouraram para infinito.
+        if (!merged) {
+            if (stats) *stats = local;
+            return false;
+        }
+    }
+
+    // Kruskal sobre as candidatas. Custos acima de `INT_MAX` entram saturados (a ordem não muda) e
+    // são recalculados em 64 bits para a soma.
+    local.candidates = candidates.size();
+    vector<IdEdge> edges;
+    edges.reserve(candidates.size());
+    for (const Candidate& e : candidates) {
+        edges.push_back({static_cast<int>(min<int64_t>(roundedCost(e.d2), INT_MAX)), e.lo, e.hi});
+    }
+    vector<Candidate>().swap(candidates);
+    vector<IdEdge> forest;
+    KruskalMST kruskal;
+    kruskal.computeForest(n, edges, forest);
+    outMst.reserve(forest.size());
+    int64_t total = 0;
+    for (const IdEdge& e : forest) {
+        double dx = xs[e.v] - xs[e.u], dy = ys[e.v] - ys[e.u];
+        int64_t w = roundedCost(dx * dx + dy * dy);
+        total += w;
+        if (total > INT_MAX) break;
+        const string& a = pts[order[e.u]]->key;
+        const string& b = pts[order[e.v]]->key;
+        outMst.push_back(a < b ? Edge(a, b, static_cast<int>(w)) : Edge(b, a, static_cast<int>(w)));
+    }
+    // Como em `SteinerTree`: a soma é feita em 64 bits e só é convertida se couber em `int`.
+    if (total > INT_MAX) {
+        outMst.clear();
+        local.overflow = true;
+    } else {
+        outTotalCost = static_cast<int>(total);
+    }
+    if (stats) *stats = local;
+    return !local.overflow;
+}
@@ -0,0 +1,52 @@
+/**
+* @file GeometricMST.h
+* @authors
+*   Francisco Eduardo Fontenele - 15452569
+*   Vinicius Botte - 15522900
+*
+* \brief MST euclidiana a partir de coordenadas, sem gerar as O(V^2) arestas do grafo completo.
+*
+* \details Rodadas de Borůvka sobre uma k-d tree produzem as arestas candidatas: em cada rodada,
+*          cada componente encontra seu vizinho mais próximo fora dele (subárvores inteiramente no
+*          mesmo componente são podadas). Empates são desfeitos por (distância, menor id, maior id),
+*          então as candidatas pertencem à mesma MST e o Kruskal final sobre elas (no máximo 2V
+*          arestas) produz a árvore. Custo de cada aresta: distância euclidiana arredondada para inteiro.
+*
+* \pre Coordenadas finitas, na unidade desejada para o custo (ex.: metros).
+* \post MST (ou árvore única) sobre todos os sítios com chaves distintas.
+*/
+
+#ifndef GEOMETRIC_MST_H
+#define GEOMETRIC_MST_H
+
+#include <cstddef>
+#include <vector>
+#include "Edge.h"
+#include "NetworkTopologyParser.h"
+using namespace std;
+
+/** \brief Estatísticas de uma execução de `GeometricMST::compute`. */
+struct GeometricStats {
+    int rounds = 0;            ///< rodadas de Borůvka
+    size_t candidates = 0;     ///< arestas candidatas entregues ao Kruskal
+    size_t duplicateKeys = 0;  ///< sítios ignorados por chave repetida
+    bool overflow = false;     ///< custo total (somado em 64 bits) não cabe em `int`
+};
+
+class GeometricMST {
+public:
+    /**
+     * \brief Calcula a MST euclidiana dos sítios.
+     * \pre Chaves repetidas: vale a primeira ocorrência.
+     * \post `outMst` tem V-1 arestas (V = sítios distintos) com custo arredondado; `outTotalCost`
+     *       é a soma desses custos. Retorna falso (e `outMst` vazio) se uma rodada de Borůvka não
+     *       unir nenhum componente, o que só ocorre com distâncias não representáveis em `double`,
+     *       ou se o custo total exceder `INT_MAX` (`stats->overflow`).
+     */
+    static bool compute(const vector<SiteCoord>& sites,
+                        vector<Edge>& outMst,
+                        int& outTotalCost,
+                        GeometricStats* stats = nullptr);
+};
+
+#endif
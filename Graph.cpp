@@ -14,8 +14,12 @@
 
 #include "Graph.h"
 #include "NetworkTopologyParser.h"
+#include "CompactGraphFormat.h"
 #include <iostream>
 #include <fstream>
+#include <algorithm>
+#include <atomic>
+#include <iterator>
 #include <utility>
 using namespace std;
 
@@ -45,6 +49,13 @@ map<string, list<pair<string, int>>> Graph::readGraph() {
     in.read(reinterpret_cast<char*>(&magic), sizeof(int));
     in.read(reinterpret_cast<char*>(&version), sizeof(int));
     if (!in || magic != MAGIC) return {};
+    if (version == VERSION_COMPACT) {
+        vector<uint8_t> body((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+        map<string, list<pair<string, int>>> result;
+        if (!CompactGraphFormat::decode(body.data(), body.size(), result)) return {};
+        format = VERSION_COMPACT;
+        return result;
+    }
     if (version != VERSION) return {};
     in.read(reinterpret_cast<char*>(&n), sizeof(int));
     map<string, list<pair<string, int>>> result;
@@ -71,10 +82,22 @@ void Graph::writeString(ofstream& out, const string& s) {
 }
 
 void Graph::writeGraph() const {
-    ofstream out(filename, ios::binary | ios::trunc);
-    if (!out) return;
+    writeGraphTo(filename, format);
+}
+
+bool Graph::writeGraphTo(const string& path, int version) const {
+    ofstream out(path, ios::binary | ios::trunc);
+    if (!out) return false;
     out.write(reinterpret_cast<const char*>(&MAGIC), sizeof(int));
-    out.write(reinterpret_cast<const char*>(&VERSION), sizeof(int));
+    out.write(reinterpret_cast<const char*>(&version), sizeof(int));
+    if (version == VERSION_COMPACT) {
+        vector<uint8_t> body;
+        // Com alterações pendentes (lote aberto), grava o lado dos escritores sem publicá-las.
+        if (current && !stale) CompactGraphFormat::encode(*current, body);
+        else CompactGraphFormat::encode(GraphSnapshot(0, adjList), body);
+        out.write(reinterpret_cast<const char*>(body.data()), static_cast<streamsize>(body.size()));
+        return static_cast<bool>(out);
+    }
     int n = static_cast<int>(adjList.size());
     out.write(reinterpret_cast<const char*>(&n), sizeof(int));
     for (const auto& kv : adjList) {
@@ -86,27 +109,138 @@ void Graph::writeGraph() const {
             out.write(reinterpret_cast<const char*>(&nb.second), sizeof(int));
         }
     }
+    return static_cast<bool>(out);
+}
+
+void Graph::publish() {
+    atomic_store(&links, shared_ptr<GraphConnectivity>());
+    auto snap = make_shared<const GraphSnapshot>(++version, adjList);
+    VertexOrder ord = order.load();
+    if (ord != VertexOrder::KEY) snap = snap->permuted(VertexOrdering::compute(*snap, ord));
+    publish(snap);
+    touched.clear();
+    verticesChanged = false;
+    stale = false;
+    addedLinks.clear();
+    linksInvalid = false;
+}
+
+void Graph::refresh() {
+    if (!stale) return;
+    if (verticesChanged || !current) {
+        publish();
+        return;
+    }
+    sort(touched.begin(), touched.end());
+    touched.erase(unique(touched.begin(), touched.end()), touched.end());
+    vector<pair<int, vector<pair<int, int>>>> rows;
+    rows.reserve(touched.size());
+    for (int id : touched) {
+        vector<pair<int, int>> row;
+        for (const auto& p : adjList.at(current->keyOf(id))) row.emplace_back(current->indexOf(p.first), p.second);
+        // Snapshots renumerados guardam os vizinhos ordenados por id (ver `permuted`).
+        if (!current->keyOrdered()) sort(row.begin(), row.end());
+        rows.emplace_back(id, std::move(row));
+    }
+    publish(current->withRows(++version, rows));
+    touched.clear();
+    stale = false;
+}
+
+void Graph::commit() {
+    if (batchDepth > 0) return;
+    vector<Edge> added;
+    added.swap(addedLinks);
+    bool invalid = linksInvalid;
+    linksInvalid = false;
+    refresh();
+    // Publica antes de ligar: nenhuma ligação fica visível em `connected` antes de estar no snapshot.
+    auto idx = atomic_load(&links);
+    if (!idx) return;
+    if (invalid) atomic_store(&links, shared_ptr<GraphConnectivity>());
+    else if (added.size() == 1) idx->link(added[0].u(), added[0].v());
+    else if (!added.empty()) idx->linkBatch(added);
+}
+
+void Graph::touch(const string& a, const string& b) {
+    if (!verticesChanged) {
+        touched.push_back(current->indexOf(a));
+        touched.push_back(current->indexOf(b));
+    }
+    stale = true;
+}
+
+void Graph::touchVertices() {
+    verticesChanged = true;
+    touched.clear();
+    stale = true;
+}
+
+void Graph::beginBatch() {
+    lock_guard<mutex> lk(writeMutex);
+    ++batchDepth;
+}
+
+void Graph::endBatch() {
+    lock_guard<mutex> lk(writeMutex);
+    if (batchDepth > 0) --batchDepth;
+    commit();
+}
+
+void Graph::setVertexOrder(VertexOrder order_) {
+    lock_guard<mutex> lk(writeMutex);
+    order = order_;
+    publish();
 }
 
-Graph::Graph(const string& filename_) : filename(filename_) {
+void Graph::publish(shared_ptr<const GraphSnapshot> next) const {
+    atomic_store(&current, std::move(next));
+}
+
+Graph::Graph(const string& filename_, VertexOrder order_) : filename(filename_), order(order_) {
     adjList = readGraph();
     if (adjList.empty()) writeGraph();
+    publish();
 }
 
 Graph::~Graph() {
+    lock_guard<mutex> lk(writeMutex);
     writeGraph();
 }
 
+shared_ptr<const GraphSnapshot> Graph::snapshot() const {
+    return atomic_load(&current);
+}
+
+shared_ptr<const GraphConnectivity> Graph::connectivity() const {
+    auto idx = atomic_load(&links);
+    if (idx) return idx;
+    lock_guard<mutex> lk(writeMutex);
+    idx = atomic_load(&links);
+    if (!idx) {
+        idx = make_shared<GraphConnectivity>(current);
+        atomic_store(&links, idx);
+    }
+    return idx;
+}
+
+bool Graph::connected(const string& a, const string& b) const {
+    return connectivity()->connected(a, b);
+}
+
 void Graph::displayGraph() const {
+    auto snap = snapshot();
+    const auto& ids = snap->neighborIds();
+    const auto& costs = snap->neighborCosts();
     cout << "\n====================\n";
     cout << "Estado atual do grafo\n";
     cout << "====================\n";
-    cout << "n = " << adjList.size() << "\n";
+    cout << "n = " << snap->vertexCount() << "\n";
     cout << "Lista de adjacencia:\n";
-    for (const auto& kv : adjList) {
-        cout << "  " << kv.first << " -> ";
-        for (const auto& p : kv.second) {
-            cout << p.first << "(" << p.second << ") ";
+    for (int u = 0; u < snap->vertexCount(); ++u) {
+        cout << "  " << snap->keyOf(u) << " -> ";
+        for (int i = snap->begin(u); i < snap->end(u); ++i) {
+            cout << snap->keyOf(ids[i]) << "(" << costs[i] << ") ";
         }
         cout << "\n";
     }
@@ -114,75 +248,103 @@ void Graph::displayGraph() const {
 }
 
 bool Graph::hasVertex(const string& key) const {
-    return adjList.find(key) != adjList.end();
+    return snapshot()->hasVertex(key);
 }
 
 bool Graph::hasEdge(const string& a, const string& b, int* outCost) const {
-    auto it = adjList.find(a);
-    if (it == adjList.end()) return false;
-    return containsNeighbor(it->second, b, outCost);
+    return snapshot()->hasEdge(a, b, outCost);
 }
 
 void Graph::insertVertex(const string& key) {
-    if (!hasVertex(key)) adjList[key] = {};
+    lock_guard<mutex> lk(writeMutex);
+    if (adjList.count(key)) return;
+    adjList[key] = {};
+    touchVertices();
+    commit();
 }
 
 void Graph::insertEdge(const string& a, const string& b, int cost) {
-    if (!hasVertex(a) || !hasVertex(b)) return;
-    int tmp;
-    if (!hasEdge(a, b, &tmp)) {
-        adjList[a].emplace_back(b, cost);
-        adjList[b].emplace_back(a, cost);
-    }
+    lock_guard<mutex> lk(writeMutex);
+    auto ita = adjList.find(a);
+    auto itb = adjList.find(b);
+    if (ita == adjList.end() || itb == adjList.end()) return;
+    if (containsNeighbor(ita->second, b, nullptr)) return;
+    ita->second.emplace_back(b, cost);
+    itb->second.emplace_back(a, cost);
+    touch(a, b);
+    addedLinks.emplace_back(a, b, cost);
+    commit();
 }
 
 void Graph::deleteUndirectedEdge(const string& a, const string& b) {
+    lock_guard<mutex> lk(writeMutex);
     auto ita = adjList.find(a);
-    if (ita != adjList.end()) {
-        ita->second.remove_if([&](const pair<string,int>& p){ return p.first == b; });
-    }
     auto itb = adjList.find(b);
-    if (itb != adjList.end()) {
-        itb->second.remove_if([&](const pair<string,int>& p){ return p.first == a; });
-    }
+    if (ita == adjList.end() || itb == adjList.end()) return;
+    if (!containsNeighbor(ita->second, b, nullptr)) return;
+    ita->second.remove_if([&](const pair<string,int>& p){ return p.first == b; });
+    itb->second.remove_if([&](const pair<string,int>& p){ return p.first == a; });
+    touch(a, b);
+    linksInvalid = true;
+    commit();
 }
 
 void Graph::deleteVertex(const string& key) {
-    adjList.erase(key);
+    lock_guard<mutex> lk(writeMutex);
+    if (!adjList.erase(key)) return;
     for (auto& kv : adjList) {
         kv.second.remove_if([&](const pair<string,int>& p){ return p.first == key; });
     }
+    touchVertices();
+    commit();
 }
 
 vector<Edge> Graph::getEdgesUnique() const {
-    vector<Edge> edges;
-    for (const auto& kv : adjList) {
-        const auto& u = kv.first;
-        for (const auto& p : kv.second) {
-            const auto& v = p.first;
-            int w = p.second;
-            if (u < v) edges.emplace_back(u, v, w);
-        }
-    }
-    return edges;
+    return snapshot()->getEdgesUnique();
 }
 
 void Graph::importFromTxt(const string& path) {
     vector<string> verts;
     vector<Edge> edges;
     NetworkTopologyParser::parse(path, verts, edges);
-    for (const auto& v : verts) insertVertex(v);
-    for (const auto& e : edges) insertEdge(e.u(), e.v(), e.weight());
+    lock_guard<mutex> lk(writeMutex);
+    bool newVertices = false;
+    for (const auto& v : verts) newVertices |= adjList.emplace(v, list<pair<string, int>>()).second;
+    vector<Edge> added;
+    for (const auto& e : edges) {
+        if (!adjList.count(e.u()) || !adjList.count(e.v())) continue;
+        auto& la = adjList[e.u()];
+        if (containsNeighbor(la, e.v(), nullptr)) continue;
+        la.emplace_back(e.v(), e.weight());
+        adjList[e.v()].emplace_back(e.u(), e.weight());
+        added.push_back(e);
+    }
+    // Publica primeiro (inclusive as pendências de um lote aberto): nenhuma ligação fica visível em
+    // `connected` antes de estar no snapshot. Sem vértices novos nem remoções pendentes, o serviço
+    // de conectividade em uso é mantido e recebe as arestas em paralelo, com consultas
+    // concorrentes; caso contrário é reconstruído na próxima consulta.
+    auto idx = atomic_load(&links);
+    bool keep = idx && !newVertices && !verticesChanged && !linksInvalid;
+    added.insert(added.end(), addedLinks.begin(), addedLinks.end());
+    publish();
+    if (keep) {
+        atomic_store(&links, idx);
+        idx->linkBatch(added);
+    }
 }
 
 void Graph::clearAndPersist() {
+    lock_guard<mutex> lk(writeMutex);
     adjList.clear();
+    publish();
     writeGraph();
 }
 
 vector<string> Graph::getAllVertices() const {
-    vector<string> vs;
-    vs.reserve(adjList.size());
-    for (const auto& kv : adjList) vs.push_back(kv.first);
-    return vs;
+    return snapshot()->getAllVertices();
+}
+
+bool Graph::saveAs(const string& path, int version) const {
+    lock_guard<mutex> lk(writeMutex);
+    return writeGraphTo(path, version);
 }
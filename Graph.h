@@ -10,6 +10,16 @@
 *          Oferece operações de criação, inserção, remoção, busca, impressão, importação de .txt
 *          e persistência em arquivo binário.
 *
+*          Duas representações, com papéis distintos: `adjList` é o lado dos escritores (alteração
+*          em O(log V + grau), base da persistência) e o `GraphSnapshot` em CSR é a versão imutável
+*          dos leitores. A publicação é feita sempre pelo escritor: uma alteração isolada publica as
+*          linhas afetadas antes de retornar; entre `beginBatch` e `endBatch` as alterações só ficam
+*          pendentes e o lote inteiro é publicado uma vez no fim (uma cópia O(V + E) por lote, não por
+*          alteração). Leitores apenas carregam o último snapshot publicado e nunca esperam por
+*          escritores; escritores são serializados entre si.
+*          Consultas de conectividade usam um `GraphConnectivity` sem travas, criado na primeira
+*          consulta e atualizado junto com cada publicação que só insere arestas.
+*
 * \pre O arquivo binário será criado se não existir; chaves devem ser adequadas ao contexto.
 * \post Instâncias mantêm estado consistente e operações atualizam a persistência ao finalizar.
 */
@@ -17,33 +27,101 @@
 #ifndef GRAPH_H
 #define GRAPH_H
 
+#include <atomic>
 #include <map>
 #include <list>
 #include <string>
 #include <vector>
 #include <fstream>
+#include <memory>
+#include <mutex>
 #include "Edge.h"
+#include "GraphConnectivity.h"
+#include "GraphSnapshot.h"
+#include "VertexOrdering.h"
 using namespace std;
 
 class Graph {
+public:
+    /** \brief Versão do formato binário compacto (ver `CompactGraphFormat.h`). */
+    static constexpr int VERSION_COMPACT = 2;
+
 private:
     string filename;
     map<string, list<pair<string, int>>> adjList;
+    mutable mutex writeMutex;
+    mutable shared_ptr<const GraphSnapshot> current;
+    mutable shared_ptr<GraphConnectivity> links;
+    uint64_t version = 0;
+    bool stale = false;
+    vector<int> touched;
+    bool verticesChanged = false;
+    vector<Edge> addedLinks;
+    bool linksInvalid = false;
+    int batchDepth = 0;
+    atomic<VertexOrder> order{VertexOrder::KEY};
     static constexpr int MAGIC = 0x47524150;
     static constexpr int VERSION = 1;
+    int format = VERSION;
 
     static string readString(ifstream& in);
     map<string, list<pair<string, int>>> readGraph();
     static void writeString(ofstream& out, const string& s);
     void writeGraph() const;
+    bool writeGraphTo(const string& path, int version) const;
+
+    /**
+     * \brief Publica um snapshot reconstruído a partir de `adjList`.
+     * \pre `writeMutex` deve estar adquirido.
+     * \post Novos leitores passam a ver a nova versão, renumerada conforme `order`;
+     *       leitores antigos mantêm a anterior. O serviço de conectividade é descartado.
+     */
+    void publish();
+
+    /**
+     * \brief Publica um snapshot já construído.
+     * \pre `writeMutex` deve estar adquirido.
+     * \post `current` aponta para `next`.
+     */
+    void publish(shared_ptr<const GraphSnapshot> next) const;
+
+    /**
+     * \brief Publica as alterações pendentes, se houver.
+     * \pre `writeMutex` deve estar adquirido.
+     * \post Só arestas alteradas: troca as linhas tocadas (`withRows`), preservando chaves e
+     *       numeração. Vértices alterados: reconstrução completa.
+     */
+    void refresh();
+
+    /**
+     * \brief Conclui uma alteração: fora de lote, publica as pendências.
+     * \pre `writeMutex` deve estar adquirido.
+     * \post Com `batchDepth == 0`, o snapshot inclui as pendências; o serviço de conectividade
+     *       recebe as arestas inseridas ou é descartado se houve remoções ou vértices alterados.
+     */
+    void commit();
+
+    /**
+     * \brief Marca as linhas de `a` e `b` como pendentes.
+     * \pre `writeMutex` deve estar adquirido.
+     * \post `stale` verdadeiro.
+     */
+    void touch(const string& a, const string& b);
+
+    /**
+     * \brief Marca alteração no conjunto de vértices (exige reconstrução completa).
+     * \pre `writeMutex` deve estar adquirido.
+     * \post `stale` verdadeiro; o serviço de conectividade é descartado na publicação.
+     */
+    void touchVertices();
 
 public:
     /**
      * \brief Constrói o grafo vinculado a um arquivo binário.
      * \pre O caminho deve ser válido; cria arquivo com cabeçalho se necessário.
-     * \post O grafo é carregado e pronto para operações.
+     * \post O grafo é carregado e pronto para operações; snapshots seguem a numeração `order_`.
      */
-    explicit Graph(const string& filename_);
+    explicit Graph(const string& filename_, VertexOrder order_ = VertexOrder::KEY);
 
     /**
      * \brief Destrói o grafo persistindo alterações.
@@ -60,14 +138,14 @@ public:
     void displayGraph() const;
 
     /**
-     * \brief Busca um vértice.
+     * \brief Busca um vértice no snapshot publicado.
      * \pre A chave não deve ser vazia.
      * \post Retorna verdadeiro se existir.
      */
     bool hasVertex(const string& key) const;
 
     /**
-     * \brief Busca uma aresta.
+     * \brief Busca uma aresta no snapshot publicado.
      * \pre As chaves devem estar definidas.
      * \post Retorna verdadeiro se houver aresta; opcionalmente retorna custo.
      */
@@ -108,6 +186,21 @@ public:
      */
     vector<Edge> getEdgesUnique() const;
 
+    /**
+     * \brief Inicia um lote de alterações (aninhável).
+     * \pre Cada chamada deve ter um `endBatch` correspondente.
+     * \post Até o `endBatch` mais externo, alterações ficam pendentes e leitores, inclusive a
+     *       própria thread, continuam vendo o snapshot anterior ao lote.
+     */
+    void beginBatch();
+
+    /**
+     * \brief Encerra um lote de alterações.
+     * \pre Precedido por `beginBatch`.
+     * \post No `endBatch` mais externo, todas as alterações do lote são publicadas de uma vez.
+     */
+    void endBatch();
+
     /**
      * \brief Importa topologia de arquivo texto.
      * \pre O arquivo deve seguir o formato suportado.
@@ -128,6 +221,57 @@ public:
      * \post Vetor com as chaves existentes, sem ordem garantida.
      */
     vector<string> getAllVertices() const;
+
+    /**
+     * \brief Obtém a versão corrente, imutável, do grafo.
+     * \pre Nenhuma; pode ser chamado de qualquer thread, inclusive durante alterações.
+     * \post Não bloqueia: carrega o último snapshot publicado, que permanece válido e inalterado
+     *       enquanto for mantido e inclui toda alteração isolada concluída antes da chamada (as de
+     *       um lote aberto aparecem no `endBatch`).
+     */
+    shared_ptr<const GraphSnapshot> snapshot() const;
+    /**
+     * \brief Obtém o serviço de conectividade do grafo.
+     * \pre Nenhuma; pode ser chamado de qualquer thread.
+     * \post Na primeira chamada (ou após remoções) o serviço é reconstruído em paralelo a partir
+     *       do snapshot publicado; depois, publicações que só inserem arestas e importações sem
+     *       vértices novos o atualizam sem travar leitores.
+     */
+    shared_ptr<const GraphConnectivity> connectivity() const;
+    /**
+     * \brief Verifica se há caminho entre dois vértices.
+     * \pre Nenhuma; pode ser chamado de qualquer thread, inclusive durante importações.
+     * \post Falso se algum dos vértices não existir.
+     */
+    bool connected(const string& a, const string& b) const;
+
+    /**
+     * \brief Versão do formato usada ao persistir no arquivo vinculado.
+     * \pre Nenhuma.
+     * \post Retorna 1 (original) ou `VERSION_COMPACT`; segue a versão do arquivo carregado.
+     */
+    int storageVersion() const { return format; }
+
+    /**
+     * \brief Define a numeração de vértices dos snapshots e republica o grafo renumerado.
+     * \pre Nenhuma.
+     * \post Snapshots publicados daqui em diante (carga, importação, vértices) usam a nova ordem.
+     */
+    void setVertexOrder(VertexOrder order_);
+
+    /**
+     * \brief Numeração de vértices em uso.
+     * \pre Nenhuma; pode ser chamado de qualquer thread, inclusive durante `setVertexOrder`.
+     * \post Retorna a ordem configurada.
+     */
+    VertexOrder vertexOrder() const { return order.load(); }
+
+    /**
+     * \brief Grava uma cópia do estado atual em outro arquivo.
+     * \pre `version` deve ser 1 ou `VERSION_COMPACT`; caminho gravável.
+     * \post Retorna falso se o arquivo não pôde ser gravado.
+     */
+    bool saveAs(const string& path, int version) const;
 };
 
 #endif
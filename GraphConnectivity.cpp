@@ -0,0 +1,72 @@
+/**
+* @file GraphConnectivity.cpp
+* @authors
+*   Francisco Eduardo Fontenele - 15452569
+*   Vinicius Botte - 15522900
+*
+* \brief Implementação do serviço de conectividade.
+*
+* \details A construção e `linkBatch` dividem o trabalho em blocos fixos submetidos ao pool; cada
+*          bloco chama `unite` diretamente na estrutura compartilhada.
+*
+* \pre Nenhuma.
+* \post Nenhuma.
+*/
+
+#include "GraphConnectivity.h"
+#include "WorkStealingPool.h"
+#include <algorithm>
+#include <atomic>
+using namespace std;
+
+/** \brief Vértices (ou arestas) por tarefa nas operações em lote. */
+static constexpr size_t LINK_CHUNK = 16384;
+
+GraphConnectivity::GraphConnectivity(shared_ptr<const GraphSnapshot> snap, unsigned threads)
+    : base(std::move(snap)), sets(base->vertexCount()) {
+    const auto& ids = base->neighborIds();
+    int n = base->vertexCount();
+    WorkStealingPool pool(threads);
+    for (int lo = 0; lo < n; lo += static_cast<int>(LINK_CHUNK)) {
+        int hi = min(n, lo + static_cast<int>(LINK_CHUNK));
+        pool.submit([this, &ids, lo, hi] {
+            for (int u = lo; u < hi; ++u) {
+                for (int i = base->begin(u); i < base->end(u); ++i) {
+                    if (u < ids[i]) sets.unite(u, ids[i]);
+                }
+            }
+        });
+    }
+    pool.wait();
+}
+
+bool GraphConnectivity::connected(const string& a, const string& b) const {
+    int u = base->indexOf(a);
+    int v = base->indexOf(b);
+    if (u < 0 || v < 0) return false;
+    return sets.sameSet(u, v);
+}
+
+bool GraphConnectivity::link(const string& a, const string& b) {
+    int u = base->indexOf(a);
+    int v = base->indexOf(b);
+    if (u < 0 || v < 0) return false;
+    return sets.unite(u, v);
+}
+
+size_t GraphConnectivity::linkBatch(const vector<Edge>& edges, unsigned threads) {
+    atomic<size_t> merged{0};
+    WorkStealingPool pool(threads);
+    for (size_t lo = 0; lo < edges.size(); lo += LINK_CHUNK) {
+        size_t hi = min(edges.size(), lo + LINK_CHUNK);
+        pool.submit([this, &edges, &merged, lo, hi] {
+            size_t local = 0;
+            for (size_t k = lo; k < hi; ++k) {
+                if (link(edges[k].u(), edges[k].v())) ++local;
+            }
+            merged.fetch_add(local, memory_order_relaxed);
+        });
+    }
+    pool.wait();
+    return merged.load();
+}
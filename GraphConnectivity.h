@@ -0,0 +1,85 @@
+/**
+* @file GraphConnectivity.h
+* @authors
+*   Francisco Eduardo Fontenele - 15452569
+*   Vinicius Botte - 15522900
+*
+* \brief Serviço de conectividade ("A e B estão ligados?") sobre as arestas de um grafo.
+*
+* \details Mapeia chaves para os ids de um `GraphSnapshot` base e mantém um `ConcurrentUnionFind`
+*          sobre eles. Consultas (`connected`) e novas ligações (`link`, `linkBatch`) podem ocorrer
+*          ao mesmo tempo em qualquer número de threads, sem travas. O conjunto de vértices é o do
+*          snapshot base; remoções não são suportadas (um novo serviço deve ser construído).
+*
+* \pre Snapshot base válido.
+* \post Respostas refletem as arestas do snapshot base mais as ligadas depois.
+*/
+
+#ifndef GRAPH_CONNECTIVITY_H
+#define GRAPH_CONNECTIVITY_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "ConcurrentUnionFind.h"
+#include "Edge.h"
+#include "GraphSnapshot.h"
+using namespace std;
+
+class GraphConnectivity {
+private:
+    shared_ptr<const GraphSnapshot> base;
+    ConcurrentUnionFind sets;
+
+public:
+    /**
+     * \brief Constrói o serviço unindo as arestas de `snap` em paralelo.
+     * \pre `snap` não nulo; `threads` = 0 usa o número de núcleos.
+     * \post Componentes iguais aos do snapshot.
+     */
+    explicit GraphConnectivity(shared_ptr<const GraphSnapshot> snap, unsigned threads = 0);
+
+    /**
+     * \brief Verifica se existe caminho entre `a` e `b`.
+     * \pre Nenhuma; seguro durante ligações concorrentes.
+     * \post Falso se alguma chave não pertencer ao snapshot base.
+     */
+    bool connected(const string& a, const string& b) const;
+
+    /**
+     * \brief Registra a aresta `a`–`b`.
+     * \pre Nenhuma; seguro durante consultas concorrentes.
+     * \post Retorna verdadeiro se a aresta uniu dois componentes.
+     */
+    bool link(const string& a, const string& b);
+
+    /**
+     * \brief Registra um lote de arestas dividido entre threads do `WorkStealingPool`.
+     * \pre `threads` = 0 usa o número de núcleos.
+     * \post Retorna quantas arestas uniram componentes; arestas com chaves desconhecidas são ignoradas.
+     */
+    size_t linkBatch(const vector<Edge>& edges, unsigned threads = 0);
+
+    /**
+     * \brief Representante do componente de um id do snapshot base.
+     * \pre `0 <= id < vertexCount()` do snapshot base.
+     * \post Ids do mesmo componente têm o mesmo representante quando não há ligações em andamento.
+     */
+    int representative(int id) const { return sets.find(id); }
+
+    /**
+     * \brief Verifica se a chave pertence ao snapshot base.
+     * \pre Nenhuma.
+     * \post Retorna verdadeiro se a chave tiver id.
+     */
+    bool covers(const string& key) const { return base->indexOf(key) >= 0; }
+
+    /**
+     * \brief Número de componentes conexos.
+     * \pre Nenhuma.
+     * \post Exato quando não há ligações em andamento.
+     */
+    int componentCount() const { return sets.componentCount(); }
+};
+
+#endif
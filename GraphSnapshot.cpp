@@ -0,0 +1,148 @@
+/**
+* @file GraphSnapshot.cpp
+* @authors
+*   Francisco Eduardo Fontenele - 15452569
+*   Vinicius Botte - 15522900
+*
+* \brief Implementação do snapshot CSR imutável do grafo.
+*
+* \details Alterações de aresta copiam os vetores CSR trocando só as linhas alteradas, sem
+*          reconstruir o mapeamento de chaves.
+*
+* \pre Chaves armazenadas em ordem crescente.
+* \post Consultas somente leitura, seguras entre threads.
+*/
+
+#include "GraphSnapshot.h"
+#include <algorithm>
+#include <numeric>
+using namespace std;
+
+GraphSnapshot::GraphSnapshot(uint64_t version, const map<string, list<pair<string, int>>>& adj) : ver(version) {
+    auto sorted = make_shared<vector<string>>();
+    sorted->reserve(adj.size());
+    size_t entries = 0;
+    for (const auto& kv : adj) {
+        sorted->push_back(kv.first);
+        entries += kv.second.size();
+    }
+    keys = sorted;
+
+    offsets.reserve(adj.size() + 1);
+    targets.reserve(entries);
+    weights.reserve(entries);
+    offsets.push_back(0);
+    for (const auto& kv : adj) {
+        for (const auto& p : kv.second) {
+            targets.push_back(indexOf(p.first));
+            weights.push_back(p.second);
+        }
+        offsets.push_back(static_cast<int>(targets.size()));
+    }
+}
+
+int GraphSnapshot::indexOf(const string& key) const {
+    if (byKey) {
+        auto it = lower_bound(byKey->begin(), byKey->end(), key,
+                              [&](int id, const string& k) { return (*keys)[id] < k; });
+        if (it == byKey->end() || (*keys)[*it] != key) return -1;
+        return *it;
+    }
+    auto it = lower_bound(keys->begin(), keys->end(), key);
+    if (it == keys->end() || *it != key) return -1;
+    return static_cast<int>(it - keys->begin());
+}
+
+Edge GraphSnapshot::makeEdge(int u, int v, int cost) const {
+    const string& a = (*keys)[u];
+    const string& b = (*keys)[v];
+    return a < b ? Edge(a, b, cost) : Edge(b, a, cost);
+}
+
+shared_ptr<const GraphSnapshot> GraphSnapshot::permuted(const vector<int>& order) const {
+    int n = vertexCount();
+    vector<int> newId(static_cast<size_t>(n));
+    for (int i = 0; i < n; ++i) newId[order[i]] = i;
+
+    shared_ptr<GraphSnapshot> next(new GraphSnapshot());
+    next->ver = ver;
+    auto renamed = make_shared<vector<string>>();
+    renamed->reserve(static_cast<size_t>(n));
+    for (int i = 0; i < n; ++i) renamed->push_back((*keys)[order[i]]);
+    auto sortedIds = make_shared<vector<int>>(static_cast<size_t>(n));
+    iota(sortedIds->begin(), sortedIds->end(), 0);
+    sort(sortedIds->begin(), sortedIds->end(), [&](int x, int y) { return (*renamed)[x] < (*renamed)[y]; });
+    next->keys = renamed;
+    next->byKey = sortedIds;
+
+    next->offsets.reserve(offsets.size());
+    next->targets.reserve(targets.size());
+    next->weights.reserve(weights.size());
+    next->offsets.push_back(0);
+    vector<pair<int, int>> row;
+    for (int i = 0; i < n; ++i) {
+        int old = order[i];
+        row.clear();
+        for (int j = offsets[old]; j < offsets[old + 1]; ++j) row.emplace_back(newId[targets[j]], weights[j]);
+        sort(row.begin(), row.end());
+        for (const auto& p : row) {
+            next->targets.push_back(p.first);
+            next->weights.push_back(p.second);
+        }
+        next->offsets.push_back(static_cast<int>(next->targets.size()));
+    }
+    return next;
+}
+
+shared_ptr<const GraphSnapshot> GraphSnapshot::withRows(uint64_t version,
+                                                        const vector<pair<int, vector<pair<int, int>>>>& rows) const {
+    size_t entries = targets.size();
+    for (const auto& r : rows) entries += r.second.size() - static_cast<size_t>(offsets[r.first + 1] - offsets[r.first]);
+    shared_ptr<GraphSnapshot> next(new GraphSnapshot());
+    next->ver = version;
+    next->keys = keys;
+    next->byKey = byKey;
+    next->offsets.resize(offsets.size());
+    next->targets.reserve(entries);
+    next->weights.reserve(entries);
+    next->offsets[0] = 0;
+    size_t r = 0;
+    for (int x = 0; x < vertexCount(); ++x) {
+        if (r < rows.size() && rows[r].first == x) {
+            for (const auto& p : rows[r].second) {
+                next->targets.push_back(p.first);
+                next->weights.push_back(p.second);
+            }
+            ++r;
+        } else {
+            next->targets.insert(next->targets.end(), targets.begin() + offsets[x], targets.begin() + offsets[x + 1]);
+            next->weights.insert(next->weights.end(), weights.begin() + offsets[x], weights.begin() + offsets[x + 1]);
+        }
+        next->offsets[x + 1] = static_cast<int>(next->targets.size());
+    }
+    return next;
+}
+
+bool GraphSnapshot::hasEdge(const string& a, const string& b, int* outCost) const {
+    int u = indexOf(a);
+    int v = indexOf(b);
+    if (u < 0 || v < 0) return false;
+    for (int i = offsets[u]; i < offsets[u + 1]; ++i) {
+        if (targets[i] == v) {
+            if (outCost) *outCost = weights[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+vector<Edge> GraphSnapshot::getEdgesUnique() const {
+    vector<Edge> edges;
+    edges.reserve(edgeCount());
+    for (int u = 0; u < vertexCount(); ++u) {
+        for (int i = offsets[u]; i < offsets[u + 1]; ++i) {
+            if (u < targets[i]) edges.push_back(makeEdge(u, targets[i], weights[i]));
+        }
+    }
+    return edges;
+}
@@ -0,0 +1,162 @@
+/**
+* @file GraphSnapshot.h
+* @authors
+*   Francisco Eduardo Fontenele - 15452569
+*   Vinicius Botte - 15522900
+*
+* \brief Visão imutável e versionada do grafo em formato CSR (Compressed Sparse Row).
+*
+* \details Cada versão publicada por `Graph` é um snapshot somente leitura: chaves ordenadas,
+*          deslocamentos por vértice e vetores paralelos de vizinhos/custos. Leitores mantêm o
+*          snapshot por `shared_ptr` e nunca observam alterações posteriores; a versão é liberada
+*          quando o último leitor a solta. Versões que só alteram arestas compartilham as chaves e a
+*          numeração.
+*          Os ids seguem a ordem das chaves, a menos que o snapshot tenha sido renumerado por
+*          `permuted` (ver `VertexOrdering.h`); nesse caso `indexOf` usa um índice ordenado à parte.
+*
+* \pre Construído apenas por `Graph` (ou a partir de uma lista de adjacência consistente).
+* \post Todas as consultas são seguras para uso concorrente por várias threads.
+*/
+
+#ifndef GRAPH_SNAPSHOT_H
+#define GRAPH_SNAPSHOT_H
+
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Edge.h"
+using namespace std;
+
+class GraphSnapshot {
+private:
+    uint64_t ver = 0;
+    shared_ptr<const vector<string>> keys;
+    shared_ptr<const vector<int>> byKey;
+    vector<int> offsets;
+    vector<int> targets;
+    vector<int> weights;
+
+    GraphSnapshot() = default;
+
+public:
+    /**
+     * \brief Constrói o snapshot a partir da lista de adjacência.
+     * \pre Toda chave de vizinho deve existir em `adj`.
+     * \post CSR preserva a ordem de inserção dos vizinhos.
+     */
+    GraphSnapshot(uint64_t version, const map<string, list<pair<string, int>>>& adj);
+
+    /**
+     * \brief Nova versão com as listas de vizinhos de alguns vértices substituídas (copy-on-write).
+     * \pre `rows` ordenado por id, sem ids repetidos; pares `(vizinho, custo)` simétricos entre as linhas.
+     * \post Chaves e numeração compartilhadas com esta versão; uma única cópia O(V + E) para o lote
+     *       inteiro de alterações de arestas, sem buscas por chave.
+     */
+    shared_ptr<const GraphSnapshot> withRows(uint64_t version,
+                                             const vector<pair<int, vector<pair<int, int>>>>& rows) const;
+
+    /**
+     * \brief Nova numeração dos vértices para melhorar a localidade de memória.
+     * \pre `order` deve ser uma permutação de [0, V); `order[novoId] = idAtual`.
+     * \post Mesma versão e mesmo grafo; vizinhos de cada vértice ordenados pelo novo id.
+     */
+    shared_ptr<const GraphSnapshot> permuted(const vector<int>& order) const;
+
+    /**
+     * \brief Cria a aresta `u`-`v` com as chaves em ordem lexicográfica.
+     * \pre `u` e `v` devem ser ids válidos.
+     * \post Mesma orientação usada por `Graph::getEdgesUnique`.
+     */
+    Edge makeEdge(int u, int v, int cost) const;
+
+    /**
+     * \brief Indica se os ids seguem a ordem das chaves.
+     * \pre Nenhuma.
+     * \post Falso para snapshots renumerados.
+     */
+    bool keyOrdered() const { return !byKey; }
+
+    /**
+     * \brief Versão (monotônica) em que o snapshot foi publicado.
+     * \pre Nenhuma.
+     * \post Retorna o número da versão.
+     */
+    uint64_t version() const { return ver; }
+
+    /**
+     * \brief Número de vértices.
+     * \pre Nenhuma.
+     * \post Retorna V.
+     */
+    int vertexCount() const { return static_cast<int>(keys->size()); }
+
+    /**
+     * \brief Número de arestas não-direcionadas.
+     * \pre Nenhuma.
+     * \post Retorna E.
+     */
+    size_t edgeCount() const { return targets.size() / 2; }
+
+    /**
+     * \brief Identificador de uma chave (busca binária nas chaves ordenadas).
+     * \pre Nenhuma.
+     * \post Retorna -1 se a chave não existir.
+     */
+    int indexOf(const string& key) const;
+
+    /**
+     * \brief Chave de um identificador.
+     * \pre `id` deve estar em [0, V).
+     * \post Referência válida enquanto o snapshot existir.
+     */
+    const string& keyOf(int id) const { return (*keys)[id]; }
+
+    /**
+     * \brief Intervalo de vizinhos de `id` em `neighborIds()`/`neighborCosts()`.
+     * \pre `id` deve estar em [0, V).
+     * \post Vizinhos estão em [begin(id), end(id)).
+     */
+    int begin(int id) const { return offsets[id]; }
+    int end(int id) const { return offsets[id + 1]; }
+
+    /**
+     * \brief Vetores CSR de vizinhos e custos.
+     * \pre Nenhuma.
+     * \post Indexados pelos intervalos de `begin`/`end`.
+     */
+    const vector<int>& neighborIds() const { return targets; }
+    const vector<int>& neighborCosts() const { return weights; }
+
+    /**
+     * \brief Busca um vértice.
+     * \pre Nenhuma.
+     * \post Retorna verdadeiro se existir.
+     */
+    bool hasVertex(const string& key) const { return indexOf(key) >= 0; }
+
+    /**
+     * \brief Busca uma aresta.
+     * \pre Nenhuma.
+     * \post Retorna verdadeiro se houver aresta; opcionalmente retorna custo.
+     */
+    bool hasEdge(const string& a, const string& b, int* outCost = nullptr) const;
+
+    /**
+     * \brief Recupera arestas únicas (`u < v` por id), com chaves em ordem lexicográfica.
+     * \pre Nenhuma.
+     * \post Cada aresta não-direcionada aparece uma vez.
+     */
+    vector<Edge> getEdgesUnique() const;
+
+    /**
+     * \brief Retorna as chaves de vértices na ordem dos ids.
+     * \pre Nenhuma.
+     * \post Vetor de chaves; ordenado se `keyOrdered()`.
+     */
+    vector<string> getAllVertices() const { return *keys; }
+};
+
+#endif
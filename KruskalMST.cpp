@@ -13,61 +13,205 @@
 */
 
 #include "KruskalMST.h"
+#include "GraphConnectivity.h"
+#include "WorkStealingPool.h"
 #include <algorithm>
+#include <numeric>
 using namespace std;
 
-void KruskalMST::makeSet(const vector<string>& vertices) {
-    parent.clear();
-    rank.clear();
-    for (const auto& v : vertices) {
-        parent[v] = v;
-        rank[v] = 0;
-    }
+// Ordem total (custo, u, v): empates não dependem da ordem de entrada nem da implementação do sort,
+// então a mesma entrada sempre produz a mesma floresta (e os mesmos clusters).
+static bool lighter(const IdEdge& x, const IdEdge& y) {
+    if (x.w != y.w) return x.w < y.w;
+    return x.u != y.u ? x.u < y.u : x.v < y.v;
 }
 
-string KruskalMST::findSet(const string& v) {
-    auto it = parent.find(v);
-    if (it == parent.end()) return v;
-    if (it->second == v) return v;
-    it->second = findSet(it->second);
-    return it->second;
+void KruskalMST::makeSet(int vertexCount) {
+    idParent.resize(static_cast<size_t>(vertexCount));
+    iota(idParent.begin(), idParent.end(), 0);
+    idRank.assign(static_cast<size_t>(vertexCount), 0);
 }
 
-void KruskalMST::unionSets(const string& a, const string& b) {
-    string ra = findSet(a);
-    string rb = findSet(b);
-    if (ra == rb) return;
-    if (rank[ra] < rank[rb]) {
-        parent[ra] = rb;
-    } else if (rank[ra] > rank[rb]) {
-        parent[rb] = ra;
-    } else {
-        parent[rb] = ra;
-        rank[ra] += 1;
+int KruskalMST::findId(int v) {
+    while (idParent[v] != v) {
+        idParent[v] = idParent[idParent[v]];
+        v = idParent[v];
     }
+    return v;
+}
+
+void KruskalMST::unite(int ru, int rv) {
+    if (idRank[ru] < idRank[rv]) swap(ru, rv);
+    idParent[rv] = ru;
+    if (idRank[ru] == idRank[rv]) idRank[ru] += 1;
 }
 
 void KruskalMST::compute(const Graph& g, vector<Edge>& outMst, int& outTotalCost) {
+    compute(*g.snapshot(), outMst, outTotalCost);
+}
+
+void KruskalMST::compute(const GraphSnapshot& snap, vector<Edge>& outMst, int& outTotalCost,
+                         PhaseProfiler* profiler) {
     outMst.clear();
     outTotalCost = 0;
 
-    vector<Edge> edges = g.getEdgesUnique();
-    sort(edges.begin(), edges.end());
+    vector<IdEdge> edges;
+    {
+        PhaseScope phase(profiler, "extracao de arestas");
+        const auto& ids = snap.neighborIds();
+        const auto& costs = snap.neighborCosts();
+        edges.reserve(snap.edgeCount());
+        for (int u = 0; u < snap.vertexCount(); ++u) {
+            for (int i = snap.begin(u); i < snap.end(u); ++i) {
+                if (u < ids[i]) edges.push_back({costs[i], u, ids[i]});
+            }
+        }
+    }
 
-    vector<string> vertices = g.getAllVertices();
-    sort(vertices.begin(), vertices.end());
-    vertices.erase(unique(vertices.begin(), vertices.end()), vertices.end());
+    vector<IdEdge> forest;
+    computeForest(snap.vertexCount(), edges, forest, profiler);
+    {
+        PhaseScope phase(profiler, "saida");
+        outMst.reserve(forest.size());
+        for (const auto& e : forest) {
+            outMst.push_back(snap.makeEdge(e.u, e.v, e.w));
+            outTotalCost += e.w;
+        }
+    }
+}
 
-    makeSet(vertices);
+void KruskalMST::computeForest(int vertexCount, vector<IdEdge>& edges, vector<IdEdge>& outForest,
+                               PhaseProfiler* profiler) {
+    outForest.clear();
+    {
+        PhaseScope phase(profiler, "ordenacao");
+        sort(edges.begin(), edges.end(), lighter);
+    }
+
+    PhaseScope phase(profiler, "union-find");
+    makeSet(vertexCount);
+    outForest.reserve(static_cast<size_t>(max(vertexCount - 1, 0)));
 
     for (const auto& e : edges) {
-        string ru = findSet(e.u());
-        string rv = findSet(e.v());
+        int ru = findId(e.u);
+        int rv = findId(e.v);
+        if (ru == rv) continue;
+        outForest.push_back(e);
+        unite(ru, rv);
+    }
+}
+
+void KruskalMST::computeByComponent(const Graph& g, vector<ComponentMST>& outComponents, unsigned threads) {
+    outComponents.clear();
 
+    auto snap = g.snapshot();
+    vector<string> vertices = snap->getAllVertices();
+
+    // Rotulagem em paralelo: as threads unem blocos de arestas no mesmo Union-Find sem travas.
+    GraphConnectivity components(snap, threads);
+
+    // Cada componente numera seus vértices de 0 em diante (`local`), para que o Union-Find de cada
+    // tarefa tenha só o tamanho do componente; `members` traduz de volta para os ids do snapshot.
+    vector<int> slot(vertices.size(), -1);
+    vector<int> root(vertices.size());
+    vector<int> local(vertices.size());
+    vector<vector<int>> members;
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        int r = components.representative(static_cast<int>(i));
+        root[i] = r;
+        if (slot[r] < 0) {
+            slot[r] = static_cast<int>(outComponents.size());
+            outComponents.emplace_back();
+            members.emplace_back();
+        }
+        local[i] = static_cast<int>(members[slot[r]].size());
+        members[slot[r]].push_back(static_cast<int>(i));
+        outComponents[slot[r]].vertices.push_back(vertices[i]);
+    }
+
+    vector<vector<IdEdge>> componentEdges(outComponents.size());
+    const auto& ids = snap->neighborIds();
+    const auto& costs = snap->neighborCosts();
+    for (int u = 0; u < snap->vertexCount(); ++u) {
+        for (int i = snap->begin(u); i < snap->end(u); ++i) {
+            if (u < ids[i]) componentEdges[slot[root[u]]].push_back({costs[i], local[u], local[ids[i]]});
+        }
+    }
+
+    vector<size_t> order(outComponents.size());
+    iota(order.begin(), order.end(), 0);
+    stable_sort(order.begin(), order.end(), [&](size_t x, size_t y) {
+        return outComponents[x].vertices.size() > outComponents[y].vertices.size();
+    });
+
+    {
+        WorkStealingPool pool(threads);
+        for (size_t c : order) {
+            pool.submit([&, c] {
+                KruskalMST engine;
+                vector<IdEdge> forest;
+                engine.computeForest(static_cast<int>(members[c].size()), componentEdges[c], forest);
+                ComponentMST& out = outComponents[c];
+                out.edges.reserve(forest.size());
+                for (const auto& e : forest) {
+                    out.edges.push_back(snap->makeEdge(members[c][e.u], members[c][e.v], e.w));
+                    out.totalCost += e.w;
+                }
+            });
+        }
+        pool.wait();
+    }
+
+    vector<ComponentMST> sorted;
+    sorted.reserve(order.size());
+    for (size_t c : order) sorted.push_back(std::move(outComponents[c]));
+    outComponents = std::move(sorted);
+}
+
+void KruskalMST::cluster(const Graph& g, int k, Clustering& out, int maxWeight) {
+    out = Clustering();
+
+    auto snap = g.snapshot();
+    const int n = snap->vertexCount();
+    out.vertices = snap->getAllVertices();
+    makeSet(n);
+
+    // Heap em vez de sort: a parada antecipada evita ordenar o restante do fluxo de arestas.
+    vector<IdEdge> heap;
+    heap.reserve(snap->edgeCount());
+    const auto& ids = snap->neighborIds();
+    const auto& costs = snap->neighborCosts();
+    for (int u = 0; u < n; ++u) {
+        for (int i = snap->begin(u); i < snap->end(u); ++i) {
+            if (u < ids[i]) heap.push_back({costs[i], u, ids[i]});
+        }
+    }
+    auto heavier = [](const IdEdge& x, const IdEdge& y) { return lighter(y, x); };
+    make_heap(heap.begin(), heap.end(), heavier);
+
+    size_t components = out.vertices.size();
+    size_t target = static_cast<size_t>(max(k, 1));
+    while (components > target && !heap.empty()) {
+        if (heap.front().w > maxWeight) break;
+        pop_heap(heap.begin(), heap.end(), heavier);
+        IdEdge e = heap.back();
+        heap.pop_back();
+        ++out.edgesScanned;
+
+        int ru = findId(e.u);
+        int rv = findId(e.v);
         if (ru != rv) {
-            outMst.push_back(e);
-            outTotalCost += e.weight();
-            unionSets(ru, rv);
+            out.edges.push_back(snap->makeEdge(e.u, e.v, e.w));
+            unite(ru, rv);
+            --components;
         }
     }
+
+    vector<int> label(static_cast<size_t>(n), -1);
+    out.cluster.reserve(out.vertices.size());
+    for (int v = 0; v < n; ++v) {
+        int& l = label[findId(v)];
+        if (l < 0) l = out.clusterCount++;
+        out.cluster.push_back(l);
+    }
 }
@@ -18,37 +18,70 @@
 
 #include <vector>
 #include <string>
-#include <unordered_map>
+#include <limits>
 #include "Graph.h"
 #include "Edge.h"
+#include "PhaseProfiler.h"
 
 using namespace std;
 
+/**
+ * \brief Resultado da MST de um componente conexo.
+ * \details `vertices` lista as chaves do componente; `edges` e `totalCost` descrevem sua árvore.
+ */
+struct ComponentMST {
+    vector<string> vertices;
+    vector<Edge> edges;
+    int totalCost = 0;
+};
+
+/**
+ * \brief Resultado do agrupamento single-linkage por Kruskal interrompido.
+ * \details `cluster[i]` é o rótulo (0..clusterCount-1) do vértice `vertices[i]`;
+ *          `edgesScanned` conta as arestas retiradas do fluxo antes da parada.
+ */
+struct Clustering {
+    vector<string> vertices;
+    vector<int> cluster;
+    int clusterCount = 0;
+    vector<Edge> edges;
+    size_t edgesScanned = 0;
+};
+
+/**
+ * \brief Aresta por ids de um snapshot (custo primeiro, como é ordenada).
+ */
+struct IdEdge {
+    int w;
+    int u;
+    int v;
+};
+
 class KruskalMST {
 private:
-    unordered_map<string, string> parent;
-    unordered_map<string, int> rank;
+    vector<int> idParent;
+    vector<int> idRank;
 
     /**
-     * \brief Inicializa estruturas de Union-Find para as chaves fornecidas.
-     * \pre Vetor de chaves deve conter todos os vértices do grafo.
-     * \post Cada vértice é seu próprio representante e rank inicia em zero.
+     * \brief Inicializa o Union-Find para ids em `[0, vertexCount)`.
+     * \pre `vertexCount >= 0`.
+     * \post Cada id é seu próprio representante e rank inicia em zero.
      */
-    void makeSet(const vector<string>& vertices);
+    void makeSet(int vertexCount);
 
     /**
-     * \brief Encontra o representante do conjunto usando path compression.
-     * \pre A chave deve existir nas estruturas de Union-Find.
-     * \post Retorna o líder do conjunto e reduz profundidade da árvore de representantes.
+     * \brief Representante do conjunto de um id (path halving).
+     * \pre `makeSet` chamado com `v` no intervalo.
+     * \post Retorna o id líder do conjunto.
      */
-    string findSet(const string& v);
+    int findId(int v);
 
     /**
      * \brief Une dois conjuntos distintos usando union by rank.
-     * \pre Ambos representantes devem ser válidos e possivelmente distintos.
+     * \pre `ru` e `rv` são representantes distintos.
      * \post Conjuntos são unidos e ranks atualizados conforme necessário.
      */
-    void unionSets(const string& a, const string& b);
+    void unite(int ru, int rv);
 
 public:
     /**
@@ -57,6 +90,43 @@ public:
      * \post Retorna arestas selecionadas e custo total por referência de saída.
      */
     void compute(const Graph& g, vector<Edge>& outMst, int& outTotalCost);
+
+    /**
+     * \brief Calcula a MST sobre uma versão imutável do grafo.
+     * \pre O snapshot pode ser usado enquanto outras threads alteram o `Graph` de origem.
+     * \post Resultado consistente com a versão `snap.version()`.
+     * \details Opera sobre os ids do snapshot (Union-Find em vetores), então a numeração dos
+     *          vértices (`VertexOrdering`) determina a localidade dos acessos. Com `profiler`,
+     *          registra as fases "extracao de arestas", "ordenacao", "union-find" e "saida".
+     */
+    void compute(const GraphSnapshot& snap, vector<Edge>& outMst, int& outTotalCost,
+                 PhaseProfiler* profiler = nullptr);
+
+    /**
+     * \brief Floresta mínima de um subconjunto de arestas por ids, sem passar por chaves.
+     * \pre Todo id de `edges` está em `[0, vertexCount)`.
+     * \post `edges` fica ordenado por (custo, u, v); `outForest` recebe as arestas escolhidas nessa
+     *       ordem, de modo que a floresta não depende da ordem de entrada nem da implementação do sort.
+     * \details Registra as fases "ordenacao" e "union-find" em `profiler`. Usado pelo Kruskal do
+     *          snapshot, para juntar florestas parciais (`PartitionedMST`) e no fecho de terminais
+     *          de `SteinerTree`.
+     */
+    void computeForest(int vertexCount, vector<IdEdge>& edges, vector<IdEdge>& outForest,
+                       PhaseProfiler* profiler = nullptr);
+
+    /**
+     * \brief Calcula a floresta mínima separada por componente conexo, em paralelo.
+     * \pre O grafo deve estar carregado; `threads == 0` usa todos os núcleos disponíveis.
+     * \post `outComponents` recebe um item por componente, do maior para o menor em vértices.
+     */
+    void computeByComponent(const Graph& g, vector<ComponentMST>& outComponents, unsigned threads = 0);
+
+    /**
+     * \brief Agrupa os vértices em até `k` clusters interrompendo Kruskal cedo.
+     * \pre `k >= 1`; arestas com custo acima de `maxWeight` nunca unem clusters.
+     * \post `out` contém os rótulos extraídos do Union-Find no momento da parada.
+     */
+    void cluster(const Graph& g, int k, Clustering& out, int maxWeight = numeric_limits<int>::max());
 };
 
 #endif
@@ -0,0 +1,189 @@
+/**
+* @file LoadClient.cpp
+* @authors
+*   Francisco Eduardo Fontenele - 15452569
+*   Vinicius Botte - 15522900
+*
+* \brief Gerador de carga para o servidor de consultas (`KruskalsMST --serve`).
+*
+* \details Abre várias conexões simultâneas, cada uma mantendo até `profundidade` requisições em
+*          pipeline. A carga é composta por `HAS_EDGE` entre vértices aleatórios e, opcionalmente,
+*          um `MST` a cada N requisições. Ao final, reporta vazão e latências p50/p99/máxima.
+*
+*          Uso: KruskalsMSTLoad [socket] [clientes] [requisicoes_por_cliente] [profundidade] [mst_a_cada]
+*
+* \pre Servidor ativo no caminho de socket informado e com ao menos um vértice.
+* \post Estatísticas de latência impressas na saída padrão.
+*/
+
+#include "QueryProtocol.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+using namespace std;
+
+using Clock = chrono::steady_clock;
+
+/**
+ * \brief Conecta ao socket Unix do servidor.
+ * \pre Caminho válido.
+ * \post Retorna descritor ou -1 em falha.
+ */
+static int connectTo(const string& path) {
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) return -1;
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(addr.sun_path)) { close(fd); return -1; }
+    memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+    if (connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof addr) != 0) { close(fd); return -1; }
+    return fd;
+}
+
+static bool sendAll(int fd, const vector<uint8_t>& buf) {
+    size_t sent = 0;
+    while (sent < buf.size()) {
+        ssize_t n = send(fd, buf.data() + sent, buf.size() - sent, 0);
+        if (n <= 0) return false;
+        sent += static_cast<size_t>(n);
+    }
+    return true;
+}
+
+/**
+ * \brief Lê quadros completos de resposta do socket.
+ * \pre `pending` acumula bytes entre chamadas.
+ * \post Chama `onFrame(id, status, carga)` para cada quadro; retorna falso se a conexão caiu.
+ */
+template <typename F>
+static bool readFrames(int fd, vector<uint8_t>& pending, F onFrame) {
+    uint8_t buf[64 * 1024];
+    ssize_t n = recv(fd, buf, sizeof buf, 0);
+    if (n <= 0) return false;
+    pending.insert(pending.end(), buf, buf + n);
+    size_t pos = 0;
+    while (pending.size() - pos >= sizeof(uint32_t) + QUERY_HEADER) {
+        uint32_t len = 0, id = 0;
+        memcpy(&len, &pending[pos], sizeof len);
+        if (pending.size() - pos < sizeof(uint32_t) + len) break;
+        memcpy(&id, &pending[pos + 4], sizeof id);
+        uint8_t status = pending[pos + 8];
+        onFrame(id, status, &pending[pos + 9], len - QUERY_HEADER);
+        pos += sizeof(uint32_t) + len;
+    }
+    pending.erase(pending.begin(), pending.begin() + static_cast<ptrdiff_t>(pos));
+    return true;
+}
+
+/**
+ * \brief Obtém as chaves de vértices do servidor.
+ * \pre Servidor ativo.
+ * \post Retorna vetor (possivelmente vazio) de chaves.
+ */
+static vector<string> fetchVertices(const string& path) {
+    vector<string> keys;
+    int fd = connectTo(path);
+    if (fd < 0) return keys;
+    vector<uint8_t> req;
+    FrameWriter w(req, 0, static_cast<uint8_t>(QueryOp::VERTICES));
+    w.finish();
+    sendAll(fd, req);
+    vector<uint8_t> pending;
+    bool done = false;
+    while (!done && readFrames(fd, pending, [&](uint32_t, uint8_t, const uint8_t* p, size_t n) {
+        FrameReader r(p, n);
+        uint32_t count = r.u32();
+        for (uint32_t i = 0; i < count && r.ok(); ++i) keys.push_back(r.str());
+        done = true;
+    })) {}
+    close(fd);
+    return keys;
+}
+
+int main(int argc, char* argv[]) {
+    string path = argc >= 2 ? argv[1] : "kruskal.sock";
+    int clients = argc >= 3 ? atoi(argv[2]) : 4;
+    int requests = argc >= 4 ? atoi(argv[3]) : 20000;
+    int depth = argc >= 5 ? atoi(argv[4]) : 32;
+    int mstEvery = argc >= 6 ? atoi(argv[5]) : 0;
+    if (clients < 1 || requests < 1 || depth < 1 || mstEvery < 0) {
+        cout << "Uso: KruskalsMSTLoad [socket] [clientes] [requisicoes_por_cliente] [profundidade] [mst_a_cada]\n";
+        return 1;
+    }
+
+    vector<string> keys = fetchVertices(path);
+    if (keys.empty()) {
+        cout << "Servidor indisponivel ou grafo vazio: " << path << "\n";
+        return 1;
+    }
+
+    vector<vector<double>> latencies(static_cast<size_t>(clients));
+    vector<int> failures(static_cast<size_t>(clients), 0);
+    auto start = Clock::now();
+    vector<thread> threads;
+    for (int t = 0; t < clients; ++t) {
+        threads.emplace_back([&, t] {
+            int fd = connectTo(path);
+            if (fd < 0) { failures[t] = requests; return; }
+            mt19937 rng(static_cast<unsigned>(t) * 7919u + 1u);
+            uniform_int_distribution<size_t> pick(0, keys.size() - 1);
+            vector<Clock::time_point> sentAt(static_cast<size_t>(requests));
+            auto& lat = latencies[t];
+            lat.reserve(static_cast<size_t>(requests));
+            vector<uint8_t> pending, batch;
+            int next = 0, received = 0;
+            while (received < requests) {
+                batch.clear();
+                while (next < requests && next - received < depth) {
+                    bool mst = mstEvery > 0 && (next + 1) % mstEvery == 0;
+                    FrameWriter w(batch, static_cast<uint32_t>(next),
+                                  static_cast<uint8_t>(mst ? QueryOp::MST : QueryOp::HAS_EDGE));
+                    if (!mst) {
+                        w.str(keys[pick(rng)]);
+                        w.str(keys[pick(rng)]);
+                    }
+                    w.finish();
+                    sentAt[next] = Clock::now();
+                    ++next;
+                }
+                if (!batch.empty() && !sendAll(fd, batch)) break;
+                bool alive = readFrames(fd, pending, [&](uint32_t id, uint8_t status, const uint8_t*, size_t) {
+                    auto now = Clock::now();
+                    lat.push_back(chrono::duration<double, micro>(now - sentAt[id]).count());
+                    if (status == static_cast<uint8_t>(QueryStatus::FAILED)) ++failures[t];
+                    ++received;
+                });
+                if (!alive) break;
+            }
+            failures[t] += requests - received;
+            close(fd);
+        });
+    }
+    for (auto& th : threads) th.join();
+    double seconds = chrono::duration<double>(Clock::now() - start).count();
+
+    vector<double> all;
+    for (const auto& l : latencies) all.insert(all.end(), l.begin(), l.end());
+    int failed = 0;
+    for (int f : failures) failed += f;
+    if (all.empty()) {
+        cout << "Nenhuma resposta recebida.\n";
+        return 1;
+    }
+    sort(all.begin(), all.end());
+    auto pct = [&](double p) { return all[min(all.size() - 1, static_cast<size_t>(p * static_cast<double>(all.size())))]; };
+
+    cout << "Clientes: " << clients << ", profundidade: " << depth << ", respostas: " << all.size()
+         << ", falhas: " << failed << "\n";
+    cout << "Vazao: " << static_cast<long long>(static_cast<double>(all.size()) / seconds) << " req/s\n";
+    cout << "Latencia p50: " << pct(0.50) << " us, p99: " << pct(0.99) << " us, max: " << all.back() << " us\n";
+    return failed == 0 ? 0 : 2;
+}
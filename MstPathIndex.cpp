@@ -0,0 +1,157 @@
+/**
+* @file MstPathIndex.cpp
+* @authors
+*   Francisco Eduardo Fontenele - 15452569
+*   Vinicius Botte - 15522900
+*
+* \brief Implementação do índice de gargalo por binary lifting.
+*
+* \details BFS a partir de cada raiz define profundidade e pai; as tabelas são preenchidas nível a nível.
+*
+* \pre A floresta deve ser acíclica.
+* \post Consultas de aresta máxima em O(log V), inclusive em lote multithread.
+*/
+
+#include "MstPathIndex.h"
+#include "WorkStealingPool.h"
+#include <algorithm>
+using namespace std;
+
+MstPathIndex::MstPathIndex(const vector<string>& vertices, const vector<Edge>& forest)
+    : keys(vertices), edges(forest) {
+    int n = static_cast<int>(keys.size());
+    ids.reserve(keys.size());
+    for (int i = 0; i < n; ++i) ids[keys[i]] = i;
+
+    vector<vector<pair<int, int>>> adj(keys.size());
+    for (size_t i = 0; i < edges.size(); ++i) {
+        int u = ids.at(edges[i].u());
+        int v = ids.at(edges[i].v());
+        adj[u].emplace_back(v, static_cast<int>(i));
+        adj[v].emplace_back(u, static_cast<int>(i));
+    }
+
+    while ((1 << levels) < n) ++levels;
+    depth.assign(keys.size(), 0);
+    tree.assign(keys.size(), -1);
+    up.assign(static_cast<size_t>(levels) * keys.size(), 0);
+    best.assign(static_cast<size_t>(levels) * keys.size(), -1);
+
+    vector<int> queue;
+    queue.reserve(keys.size());
+    for (int r = 0; r < n; ++r) {
+        if (tree[r] >= 0) continue;
+        tree[r] = r;
+        up[r] = r;
+        queue.clear();
+        queue.push_back(r);
+        for (size_t h = 0; h < queue.size(); ++h) {
+            int x = queue[h];
+            for (const auto& p : adj[x]) {
+                int y = p.first;
+                if (tree[y] >= 0) continue;
+                tree[y] = r;
+                depth[y] = depth[x] + 1;
+                up[y] = x;
+                best[y] = p.second;
+                queue.push_back(y);
+            }
+        }
+    }
+
+    for (int j = 1; j < levels; ++j) {
+        size_t cur = static_cast<size_t>(j) * keys.size();
+        size_t prev = cur - keys.size();
+        for (int v = 0; v < n; ++v) {
+            int mid = up[prev + v];
+            up[cur + v] = up[prev + mid];
+            best[cur + v] = heavier(best[prev + v], best[prev + mid]);
+        }
+    }
+}
+
+int MstPathIndex::heavier(int x, int y) const {
+    if (x < 0) return y;
+    if (y < 0) return x;
+    return edges[y].weight() > edges[x].weight() ? y : x;
+}
+
+int MstPathIndex::indexOf(const string& key) const {
+    auto it = ids.find(key);
+    return it == ids.end() ? -1 : it->second;
+}
+
+int MstPathIndex::maxEdgeIndex(int u, int v) const {
+    if (u == v || tree[u] != tree[v]) return -1;
+    size_t n = keys.size();
+    int result = -1;
+    if (depth[u] < depth[v]) swap(u, v);
+    int diff = depth[u] - depth[v];
+    for (int j = 0; diff > 0; ++j, diff >>= 1) {
+        if (diff & 1) {
+            result = heavier(result, best[j * n + u]);
+            u = up[j * n + u];
+        }
+    }
+    if (u == v) return result;
+    for (int j = levels - 1; j >= 0; --j) {
+        size_t off = static_cast<size_t>(j) * n;
+        if (up[off + u] != up[off + v]) {
+            result = heavier(result, heavier(best[off + u], best[off + v]));
+            u = up[off + u];
+            v = up[off + v];
+        }
+    }
+    return heavier(result, heavier(best[u], best[v]));
+}
+
+int MstPathIndex::forestEdgeIndex(int u, int v) const {
+    if (u != v && up[u] == v) return best[u];
+    if (u != v && up[v] == u) return best[v];
+    return -1;
+}
+
+int MstPathIndex::lca(int u, int v) const {
+    size_t n = keys.size();
+    if (depth[u] < depth[v]) swap(u, v);
+    int diff = depth[u] - depth[v];
+    for (int j = 0; diff > 0; ++j, diff >>= 1) {
+        if (diff & 1) u = up[j * n + u];
+    }
+    if (u == v) return u;
+    for (int j = levels - 1; j >= 0; --j) {
+        size_t off = static_cast<size_t>(j) * n;
+        if (up[off + u] != up[off + v]) {
+            u = up[off + u];
+            v = up[off + v];
+        }
+    }
+    return up[u];
+}
+
+bool MstPathIndex::maxEdge(const string& a, const string& b, const Edge** out) const {
+    int u = indexOf(a);
+    int v = indexOf(b);
+    if (u < 0 || v < 0) return false;
+    int idx = maxEdgeIndex(u, v);
+    if (idx < 0) return false;
+    if (out) *out = &edges[idx];
+    return true;
+}
+
+void MstPathIndex::queryBatch(const vector<pair<string, string>>& queries, vector<int>& outWeights,
+                              unsigned threads) const {
+    outWeights.assign(queries.size(), -1);
+    WorkStealingPool pool(threads);
+    const size_t chunk = 4096;
+    for (size_t begin = 0; begin < queries.size(); begin += chunk) {
+        size_t end = min(queries.size(), begin + chunk);
+        pool.submit([&, begin, end] {
+            for (size_t i = begin; i < end; ++i) {
+                const Edge* e = nullptr;
+                if (maxEdge(queries[i].first, queries[i].second, &e)) outWeights[i] = e->weight();
+            }
+        });
+    }
+    pool.wait();
+}
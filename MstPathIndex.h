@@ -0,0 +1,139 @@
+/**
+* @file MstPathIndex.h
+* @authors
+*   Francisco Eduardo Fontenele - 15452569
+*   Vinicius Botte - 15522900
+*
+* \brief Índice de consultas de gargalo (aresta máxima no caminho) sobre a MST.
+*
+* \details Usa binary lifting: para cada vértice guarda o ancestral 2^j acima e a aresta de maior
+*          custo nesse trecho. O caminho na MST entre dois roteadores é também o caminho minimax do
+*          grafo original, então a resposta é o pior link da melhor rota.
+*
+* \pre As arestas fornecidas devem formar uma floresta sobre os vértices informados.
+* \post Consultas respondidas em O(log V) após pré-processamento O(V log V).
+*/
+
+#ifndef MST_PATH_INDEX_H
+#define MST_PATH_INDEX_H
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "Edge.h"
+using namespace std;
+
+class MstPathIndex {
+private:
+    vector<string> keys;
+    unordered_map<string, int> ids;
+    vector<Edge> edges;
+    vector<int> depth;
+    vector<int> tree;
+    int levels = 1;
+    vector<int> up;
+    vector<int> best;
+
+    /**
+     * \brief Retorna a mais pesada entre duas arestas da floresta (índices, -1 = nenhuma).
+     * \pre Índices válidos em `edges` ou -1.
+     * \post Retorna o índice de maior custo.
+     */
+    int heavier(int x, int y) const;
+
+public:
+    /**
+     * \brief Constrói o índice a partir dos vértices e das arestas da MST.
+     * \pre `forest` não deve conter ciclos; extremidades devem estar em `vertices`.
+     * \post Tabelas de ancestrais e máximos prontas para consulta.
+     */
+    MstPathIndex(const vector<string>& vertices, const vector<Edge>& forest);
+
+    /**
+     * \brief Retorna o identificador inteiro de uma chave.
+     * \pre Nenhuma.
+     * \post Retorna -1 se a chave não estiver indexada.
+     */
+    int indexOf(const string& key) const;
+
+    /**
+     * \brief Aresta de maior custo no caminho entre dois identificadores.
+     * \pre `u` e `v` devem ser identificadores válidos.
+     * \post Retorna o índice em `forestEdges()`; -1 se não conectados ou `u == v`.
+     */
+    int maxEdgeIndex(int u, int v) const;
+
+    /**
+     * \brief Indica se dois identificadores estão na mesma árvore da floresta.
+     * \pre `u` e `v` devem ser identificadores válidos.
+     * \post Retorna verdadeiro se houver caminho na MST.
+     */
+    bool sameTree(int u, int v) const { return tree[u] == tree[v]; }
+
+    /**
+     * \brief Menor ancestral comum de dois identificadores.
+     * \pre `u` e `v` devem estar na mesma árvore (`sameTree`).
+     * \post Retorna o identificador do LCA.
+     */
+    int lca(int u, int v) const;
+
+    /**
+     * \brief Pai de um vértice na floresta enraizada.
+     * \pre `v` deve ser identificador válido.
+     * \post Retorna o próprio `v` se for raiz.
+     */
+    int parentOf(int v) const { return up[v]; }
+
+    /**
+     * \brief Aresta que liga o vértice ao seu pai.
+     * \pre `v` deve ser identificador válido.
+     * \post Retorna índice em `forestEdges()`; -1 se `v` for raiz.
+     */
+    int parentEdgeIndex(int v) const { return best[v]; }
+
+    /**
+     * \brief Índice da aresta da floresta que liga diretamente `u` e `v`.
+     * \pre `u` e `v` devem ser identificadores válidos; o grafo não deve ter arestas paralelas.
+     * \post Retorna índice em `forestEdges()`; -1 se `u`-`v` não for aresta da floresta.
+     */
+    int forestEdgeIndex(int u, int v) const;
+
+    /**
+     * \brief Profundidade do vértice na sua árvore.
+     * \pre `v` deve ser identificador válido.
+     * \post Raízes têm profundidade zero.
+     */
+    int depthOf(int v) const { return depth[v]; }
+
+    /**
+     * \brief Consulta a aresta gargalo entre duas chaves.
+     * \pre As chaves devem ser distintas para haver aresta no caminho.
+     * \post Retorna verdadeiro e preenche `out` se houver caminho com ao menos uma aresta.
+     */
+    bool maxEdge(const string& a, const string& b, const Edge** out) const;
+
+    /**
+     * \brief Responde um lote de consultas em paralelo.
+     * \pre `threads == 0` usa todos os núcleos disponíveis.
+     * \post `outWeights[i]` recebe o custo gargalo da consulta i, ou -1 se não houver caminho.
+     */
+    void queryBatch(const vector<pair<string, string>>& queries, vector<int>& outWeights,
+                    unsigned threads = 0) const;
+
+    /**
+     * \brief Arestas da floresta indexada.
+     * \pre Nenhuma.
+     * \post Referência válida enquanto o índice existir.
+     */
+    const vector<Edge>& forestEdges() const { return edges; }
+
+    /**
+     * \brief Número de vértices indexados.
+     * \pre Nenhuma.
+     * \post Retorna V.
+     */
+    int vertexCount() const { return static_cast<int>(keys.size()); }
+};
+
+#endif
@@ -0,0 +1,93 @@
+/**
+* @file MstSensitivity.cpp
+* @authors
+*   Francisco Eduardo Fontenele - 15452569
+*   Vinicius Botte - 15522900
+*
+* \brief Implementação da análise de sensibilidade das arestas.
+*
+* \details Arestas fora da MST usam o índice de gargalo (`MstPathIndex`). Para as da MST, as arestas
+*          fora da árvore são processadas em ordem crescente de custo e cobrem o caminho até o LCA;
+*          um Union-Find de "próximo vértice não coberto" pula trechos já atribuídos, então cada
+*          aresta da árvore é visitada uma única vez.
+*
+* \pre O grafo deve estar carregado.
+* \post Vetor de sensibilidades preenchido.
+*/
+
+#include "MstSensitivity.h"
+#include "KruskalMST.h"
+#include "MstPathIndex.h"
+#include <algorithm>
+#include <numeric>
+using namespace std;
+
+static int nextUncovered(vector<int>& jump, int x) {
+    while (jump[x] != x) {
+        jump[x] = jump[jump[x]];
+        x = jump[x];
+    }
+    return x;
+}
+
+void MstSensitivity::analyze(const Graph& g, vector<EdgeSensitivity>& out) {
+    out.clear();
+
+    auto snap = g.snapshot();
+    vector<Edge> mst;
+    int total = 0;
+    KruskalMST kruskal;
+    kruskal.compute(*snap, mst, total);
+    MstPathIndex index(snap->getAllVertices(), mst);
+    const vector<Edge>& forest = index.forestEdges();
+
+    vector<Edge> edges = snap->getEdgesUnique();
+    vector<int> nonTree;
+    vector<int> treeOf(edges.size(), -1);
+    out.reserve(edges.size());
+    for (size_t i = 0; i < edges.size(); ++i) {
+        const Edge& e = edges[i];
+        int u = index.indexOf(e.u());
+        int v = index.indexOf(e.v());
+        treeOf[i] = index.forestEdgeIndex(u, v);
+        if (treeOf[i] >= 0) {
+            out.push_back({e, true, false, e, e.weight()});
+            continue;
+        }
+        int m = index.maxEdgeIndex(u, v);
+        if (m < 0) {
+            out.push_back({e, false, false, e, e.weight()});
+        } else {
+            out.push_back({e, false, true, forest[m], forest[m].weight()});
+        }
+        nonTree.push_back(static_cast<int>(i));
+    }
+
+    stable_sort(nonTree.begin(), nonTree.end(), [&](int x, int y) { return edges[x] < edges[y]; });
+
+    vector<int> jump(static_cast<size_t>(index.vertexCount()));
+    iota(jump.begin(), jump.end(), 0);
+    vector<int> replacement(forest.size(), -1);
+    for (int i : nonTree) {
+        int u = index.indexOf(edges[i].u());
+        int v = index.indexOf(edges[i].v());
+        if (!index.sameTree(u, v)) continue;
+        int l = index.lca(u, v);
+        for (int x : {u, v}) {
+            x = nextUncovered(jump, x);
+            while (index.depthOf(x) > index.depthOf(l)) {
+                replacement[index.parentEdgeIndex(x)] = i;
+                jump[x] = index.parentOf(x);
+                x = nextUncovered(jump, x);
+            }
+        }
+    }
+
+    for (size_t i = 0; i < out.size(); ++i) {
+        int t = treeOf[i];
+        if (t < 0 || replacement[t] < 0) continue;
+        out[i].hasPartner = true;
+        out[i].partner = edges[replacement[t]];
+        out[i].threshold = out[i].partner.weight();
+    }
+}
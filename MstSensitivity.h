@@ -0,0 +1,50 @@
+/**
+* @file MstSensitivity.h
+* @authors
+*   Francisco Eduardo Fontenele - 15452569
+*   Vinicius Botte - 15522900
+*
+* \brief Análise de sensibilidade das arestas em relação à MST.
+*
+* \details Para cada aresta da MST calcula a substituta mais barata caso o link falhe; para cada
+*          aresta fora da MST calcula o custo abaixo do qual ela passaria a integrar a árvore.
+*          Tudo a partir de uma única MST, em O(E log V).
+*
+* \pre O grafo deve estar carregado.
+* \post Retorna um registro por aresta única do grafo.
+*/
+
+#ifndef MST_SENSITIVITY_H
+#define MST_SENSITIVITY_H
+
+#include <vector>
+#include "Graph.h"
+#include "Edge.h"
+using namespace std;
+
+/**
+ * \brief Sensibilidade de uma aresta.
+ * \details Aresta da MST: `partner` é a substituta mais barata e `threshold` o custo máximo que a
+ *          aresta tolera sem sair da árvore. Aresta fora da MST: `partner` é a aresta de maior custo
+ *          no caminho da árvore e `threshold` o custo abaixo do qual ela entra na MST.
+ *          `hasPartner` é falso para pontes (sem substituta).
+ */
+struct EdgeSensitivity {
+    Edge edge;
+    bool inMst;
+    bool hasPartner;
+    Edge partner;
+    int threshold;
+};
+
+class MstSensitivity {
+public:
+    /**
+     * \brief Calcula a sensibilidade de todas as arestas do grafo.
+     * \pre O grafo não deve ter arestas paralelas (garantido por `Graph::insertEdge`).
+     * \post `out` segue a ordem de `Graph::getEdgesUnique`.
+     */
+    static void analyze(const Graph& g, vector<EdgeSensitivity>& out);
+};
+
+#endif
@@ -0,0 +1,176 @@
+/**
+* @file MstVerifier.cpp
+* @authors
+*   Francisco Eduardo Fontenele - 15452569
+*   Vinicius Botte - 15522900
+*
+* \brief Implementação da verificação de MST.
+*
+* \details Uma floresta sem ciclos em que nenhuma aresta do grafo liga duas árvores diferentes é
+*          geradora; a propriedade do ciclo então garante mínimo. Só as V-1 arestas da árvore são
+*          ordenadas; as E consultas de máximo são respondidas em uma única DFS, com Union-Find.
+*
+* \pre Nenhuma.
+* \post Nenhuma.
+*/
+
+#include "MstVerifier.h"
+#include <algorithm>
+#include <numeric>
+#include <utility>
+using namespace std;
+
+static int findRoot(vector<int>& parent, int x) {
+    while (parent[x] != x) {
+        parent[x] = parent[parent[x]];
+        x = parent[x];
+    }
+    return x;
+}
+
+bool MstVerifier::verify(const Graph& g, const vector<Edge>& candidate, int claimedCost, MstVerification& out) {
+    return verify(*g.snapshot(), candidate, claimedCost, out);
+}
+
+bool MstVerifier::verify(const GraphSnapshot& snap, const vector<Edge>& candidate, int claimedCost,
+                         MstVerification& out) {
+    out = MstVerification();
+
+    // 1. Floresta: arestas existentes, com o mesmo custo, sem ciclos. A aresta é procurada por id
+    //    na menor das duas listas de vizinhos: orientando a árvore, cada vértice paga o próprio grau
+    //    no máximo uma vez, então o passo todo custa O(V log V + E) mesmo com hubs (estrelas).
+    const auto& ids = snap.neighborIds();
+    const auto& costs = snap.neighborCosts();
+    vector<pair<int, int>> ends(candidate.size());
+    vector<int> parent(snap.vertexCount());
+    iota(parent.begin(), parent.end(), 0);
+    for (size_t k = 0; k < candidate.size(); ++k) {
+        const Edge& e = candidate[k];
+        int u = snap.indexOf(e.u());
+        int v = snap.indexOf(e.v());
+        bool found = false;
+        if (u >= 0 && v >= 0) {
+            int from = snap.end(u) - snap.begin(u) <= snap.end(v) - snap.begin(v) ? u : v;
+            int to = from == u ? v : u;
+            for (int i = snap.begin(from); i < snap.end(from) && !found; ++i) {
+                found = ids[i] == to && costs[i] == e.weight();
+                ++out.lookupScans;
+            }
+        }
+        if (!found) {
+            out.defect = MstDefect::UNKNOWN_EDGE;
+            out.witness = e;
+            return false;
+        }
+        ends[k] = {u, v};
+        int ru = findRoot(parent, u);
+        int rv = findRoot(parent, v);
+        if (ru == rv) {
+            out.defect = MstDefect::CYCLE;
+            out.witness = e;
+            return false;
+        }
+        parent[ru] = rv;
+        out.computedCost += e.weight();
+    }
+
+    // 2. Geradora: nenhuma aresta do grafo entre árvores diferentes.
+    for (int u = 0; u < snap.vertexCount(); ++u) {
+        for (int i = snap.begin(u); i < snap.end(u); ++i) {
+            if (u < ids[i] && findRoot(parent, u) != findRoot(parent, ids[i])) {
+                out.defect = MstDefect::NOT_SPANNING;
+                out.witness = snap.makeEdge(u, ids[i], costs[i]);
+                return false;
+            }
+        }
+    }
+
+    // 3. Custo informado.
+    if (out.computedCost != claimedCost) {
+        out.defect = MstDefect::COST_MISMATCH;
+        return false;
+    }
+
+    // 4. Propriedade do ciclo com LCA offline (Tarjan) na árvore de reconstrução de Kruskal:
+    //    folhas são os vértices, cada aresta da árvore vira um nó interno acima dos dois conjuntos
+    //    que une, em ordem crescente de custo. O máximo do caminho u-v é o custo do LCA(u, v).
+    int n = snap.vertexCount();
+    vector<int> order(candidate.size());
+    iota(order.begin(), order.end(), 0);
+    sort(order.begin(), order.end(), [&](int x, int y) { return candidate[x].weight() < candidate[y].weight(); });
+    int nodes = n + static_cast<int>(candidate.size());
+    vector<int> firstChild(nodes, -1), nextSibling(nodes, -1), edgeOf(nodes, -1), top(n);
+    vector<char> hasParent(nodes, 0);
+    iota(parent.begin(), parent.end(), 0);
+    iota(top.begin(), top.end(), 0);
+    for (int k = 0; k < static_cast<int>(order.size()); ++k) {
+        int ru = findRoot(parent, ends[order[k]].first);
+        int rv = findRoot(parent, ends[order[k]].second);
+        int x = n + k;
+        edgeOf[x] = order[k];
+        for (int child : {top[ru], top[rv]}) {
+            nextSibling[child] = firstChild[x];
+            firstChild[x] = child;
+            hasParent[child] = 1;
+        }
+        parent[ru] = rv;
+        top[rv] = x;
+    }
+
+    vector<int> sets(nodes), ancestor(nodes);
+    iota(sets.begin(), sets.end(), 0);
+    iota(ancestor.begin(), ancestor.end(), 0);
+    vector<char> done(n, 0);
+    vector<pair<int, int>> stack;   // (nó, próximo filho a visitar)
+    for (int root = 0; root < nodes; ++root) {
+        if (hasParent[root]) continue;
+        stack.assign(1, {root, firstChild[root]});
+        while (!stack.empty()) {
+            auto& [x, child] = stack.back();
+            if (child >= 0) {
+                int c = child;
+                child = nextSibling[c];
+                stack.push_back({c, firstChild[c]});
+                continue;
+            }
+            int finished = x;
+            stack.pop_back();
+            if (finished < n) {
+                done[finished] = 1;
+                for (int i = snap.begin(finished); i < snap.end(finished); ++i) {
+                    int v = ids[i];
+                    if (v == finished || !done[v]) continue;
+                    ++out.nonTreeChecked;
+                    int lca = ancestor[findRoot(sets, v)];
+                    const Edge& heaviest = candidate[edgeOf[lca]];
+                    if (costs[i] < heaviest.weight()) {
+                        out.defect = MstDefect::NOT_MINIMUM;
+                        out.witness = snap.makeEdge(finished, v, costs[i]);
+                        out.heaviest = heaviest;
+                        return false;
+                    }
+                }
+            }
+            if (!stack.empty()) {
+                int p = stack.back().first;
+                sets[findRoot(sets, finished)] = findRoot(sets, p);
+                ancestor[findRoot(sets, p)] = p;
+            }
+        }
+    }
+    // As arestas da própria árvore também passam pelo teste (o máximo do seu caminho é ela mesma).
+    out.nonTreeChecked -= candidate.size();
+    return true;
+}
+
+const char* MstVerifier::describe(MstDefect defect) {
+    switch (defect) {
+        case MstDefect::NONE: return "MST valida";
+        case MstDefect::UNKNOWN_EDGE: return "aresta inexistente no grafo ou com custo diferente";
+        case MstDefect::CYCLE: return "aresta fecha ciclo na arvore candidata";
+        case MstDefect::NOT_SPANNING: return "arvore nao gera o grafo (aresta liga arvores distintas)";
+        case MstDefect::COST_MISMATCH: return "custo total diferente do informado";
+        case MstDefect::NOT_MINIMUM: return "aresta fora da arvore mais barata que o maximo do seu caminho";
+    }
+    return "";
+}
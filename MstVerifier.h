@@ -0,0 +1,77 @@
+/**
+* @file MstVerifier.h
+* @authors
+*   Francisco Eduardo Fontenele - 15452569
+*   Vinicius Botte - 15522900
+*
+* \brief Verificação de certificado de MST sem recalcular a árvore.
+*
+* \details Confere que as arestas candidatas são arestas do grafo, formam uma floresta geradora
+*          (uma árvore por componente conexo), somam o custo informado e satisfazem a propriedade
+*          do ciclo: toda aresta fora da árvore custa ao menos o máximo do caminho entre suas
+*          extremidades. Os máximos vêm de LCA offline (Tarjan) na árvore de reconstrução de
+*          Kruskal da candidata: O(V log V + E α(V)), sem ordenar as arestas do grafo.
+*
+* \pre O grafo não deve ter arestas paralelas (garantido por `Graph::insertEdge`).
+* \post Resultado com o primeiro defeito encontrado e a aresta que o comprova.
+*/
+
+#ifndef MST_VERIFIER_H
+#define MST_VERIFIER_H
+
+#include <cstddef>
+#include <vector>
+#include "Graph.h"
+#include "Edge.h"
+using namespace std;
+
+/** \brief Defeito encontrado na verificação (`NONE` quando a árvore é mínima). */
+enum class MstDefect {
+    NONE,
+    UNKNOWN_EDGE,    ///< aresta candidata inexistente no grafo ou com custo diferente
+    CYCLE,           ///< aresta candidata fecha ciclo (inclui repetidas e laços)
+    NOT_SPANNING,    ///< aresta do grafo liga duas árvores da floresta candidata
+    COST_MISMATCH,   ///< soma dos custos diferente da informada
+    NOT_MINIMUM      ///< aresta fora da árvore mais barata que o máximo do seu caminho
+};
+
+/**
+ * \brief Resultado da verificação.
+ * \details `witness` é a aresta que comprova o defeito; em `NOT_MINIMUM`, `heaviest` é a aresta da
+ *          árvore que ela deveria substituir.
+ */
+struct MstVerification {
+    MstDefect defect = MstDefect::NONE;
+    Edge witness{"", "", 0};
+    Edge heaviest{"", "", 0};
+    int computedCost = 0;
+    size_t nonTreeChecked = 0;
+    size_t lookupScans = 0;   ///< vizinhos examinados ao procurar as arestas candidatas (passo 1)
+};
+
+class MstVerifier {
+public:
+    /**
+     * \brief Verifica a MST candidata sobre o snapshot corrente do grafo.
+     * \pre Nenhuma.
+     * \post Retorna verdadeiro se `candidate` for uma floresta geradora mínima de custo `claimedCost`.
+     */
+    static bool verify(const Graph& g, const vector<Edge>& candidate, int claimedCost, MstVerification& out);
+
+    /**
+     * \brief Verifica a MST candidata sobre uma versão imutável do grafo.
+     * \pre Nenhuma.
+     * \post Igual à versão com `Graph`, sobre `snap`.
+     */
+    static bool verify(const GraphSnapshot& snap, const vector<Edge>& candidate, int claimedCost,
+                       MstVerification& out);
+
+    /**
+     * \brief Descrição textual do defeito.
+     * \pre Nenhuma.
+     * \post Texto curto para a CLI.
+     */
+    static const char* describe(MstDefect defect);
+};
+
+#endif
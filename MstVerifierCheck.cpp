@@ -0,0 +1,140 @@
+/**
+* @file MstVerifierCheck.cpp
+* @authors
+*   Francisco Eduardo Fontenele - 15452569
+*   Vinicius Botte - 15522900
+*
+* \brief Verificação do `MstVerifier` em estrelas (executável `KruskalsMSTVerifierCheck`).
+*
+* \details Uma estrela é o pior caso para procurar cada aresta candidata nos vizinhos de uma das
+*          pontas: se a ponta escolhida for o centro, o passo vira O(V^2). Com `folhas` e
+*          `4 x folhas` folhas, exige que os vizinhos examinados nessa busca (`lookupScans`) não
+*          passem de `2E`, o que é determinístico; os tempos são só impressos. Também confere que
+*          MSTs corretas passam e que cada defeito (aresta ausente, custo adulterado, ciclo e árvore
+*          geradora não mínima) é apontado.
+*
+* \pre Nenhuma.
+* \post Código de saída 0 se todas as verificações passarem, 1 caso contrário.
+*/
+
+#include "MstVerifier.h"
+#include "KruskalMST.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+using namespace std;
+
+/**
+ * \brief Estrela com centro "hub" e `leaves` folhas de custos aleatórios, mais algumas cordas.
+ * \pre `leaves >= 2`.
+ * \post Snapshot pronto para Kruskal e verificação.
+ */
+static GraphSnapshot makeStar(int leaves) {
+    map<string, list<pair<string, int>>> adj;
+    mt19937 rng(static_cast<unsigned>(leaves));
+    auto link = [&](const string& a, const string& b, int w) {
+        adj[a].emplace_back(b, w);
+        adj[b].emplace_back(a, w);
+    };
+    for (int i = 0; i < leaves; ++i) link("hub", "leaf" + to_string(i), 1 + static_cast<int>(rng() % 1000));
+    for (int i = 0; i + 1 < leaves; i += 97) link("leaf" + to_string(i), "leaf" + to_string(i + 1), 1000);
+    return GraphSnapshot(1, adj);
+}
+
+/**
+ * \brief Posição em `mst` da aresta entre `a` e `b` (em qualquer orientação).
+ * \pre Nenhuma.
+ * \post Retorna -1 se a aresta não estiver na árvore.
+ */
+static int findEdge(const vector<Edge>& mst, const string& a, const string& b) {
+    for (size_t k = 0; k < mst.size(); ++k) {
+        if ((mst[k].u() == a && mst[k].v() == b) || (mst[k].u() == b && mst[k].v() == a)) return static_cast<int>(k);
+    }
+    return -1;
+}
+
+/**
+ * \brief Menor tempo de verificação em algumas repetições.
+ * \pre `mst` é a MST de `snap` com custo `cost`.
+ * \post Retorna ms; `ok` recebe o resultado da verificação.
+ */
+static double timeVerify(const GraphSnapshot& snap, const vector<Edge>& mst, int cost, MstVerification& result) {
+    double best = 0;
+    for (int r = 0; r < 3; ++r) {
+        auto t0 = chrono::steady_clock::now();
+        MstVerifier::verify(snap, mst, cost, result);
+        double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+        if (r == 0 || ms < best) best = ms;
+    }
+    return best;
+}
+
+/**
+ * \brief Ponto de entrada da verificação.
+ * \pre Argumento opcional: `[folhas]` (padrão 25000).
+ * \post Imprime buscas e tempos e retorna 1 se alguma verificação falhar.
+ */
+int main(int argc, char* argv[]) {
+    int leaves = argc >= 2 ? max(2, atoi(argv[1])) : 25000;
+    int failures = 0;
+    double ms[2] = {0, 0};
+    for (int k = 0; k < 2; ++k) {
+        int n = k == 0 ? leaves : 4 * leaves;
+        GraphSnapshot snap = makeStar(n);
+        vector<Edge> mst;
+        int cost = 0;
+        KruskalMST kruskal;
+        kruskal.compute(snap, mst, cost);
+
+        MstVerification result;
+        ms[k] = timeVerify(snap, mst, cost, result);
+        bool ok = result.defect == MstDefect::NONE;
+        bool linear = result.lookupScans <= 2 * snap.edgeCount();
+        if (!ok || !linear) ++failures;
+        cout << "Estrela com " << n << " folhas: " << result.lookupScans << " vizinhos examinados para "
+             << snap.edgeCount() << " arestas" << (linear ? "" : " (acima de 2E)") << ", " << ms[k] << " ms"
+             << (ok ? "" : " (MST rejeitada)") << "\n";
+
+        // Defeitos: aresta ausente (não geradora) e custo adulterado (aresta inexistente).
+        vector<Edge> partial(mst.begin() + 1, mst.end());
+        if (MstVerifier::verify(snap, partial, cost - mst[0].weight(), result)
+            || result.defect != MstDefect::NOT_SPANNING) ++failures;
+        vector<Edge> tampered{Edge(mst[0].u(), mst[0].v(), mst[0].weight() + 1)};
+        tampered.insert(tampered.end(), mst.begin() + 1, mst.end());
+        if (MstVerifier::verify(snap, tampered, cost + 1, result) || result.defect != MstDefect::UNKNOWN_EDGE) {
+            ++failures;
+        }
+
+        // A primeira corda leaf0-leaf1 (custo 1000) fecha o ciclo hub-leaf0-leaf1. Acrescentada à
+        // árvore, forma um ciclo; trocada pela aresta mais barata do ciclo, dá uma árvore geradora
+        // válida, porém mais cara que a mínima (a troca que gera a segunda melhor MST nesse ciclo).
+        Edge chord("leaf0", "leaf1", 1000);
+        vector<Edge> cyclic(mst);
+        cyclic.push_back(chord);
+        if (MstVerifier::verify(snap, cyclic, cost + chord.weight(), result) || result.defect != MstDefect::CYCLE
+            || result.witness.u() != chord.u() || result.witness.v() != chord.v()) {
+            ++failures;
+        }
+        int a = findEdge(mst, "hub", "leaf0");
+        int b = findEdge(mst, "hub", "leaf1");
+        int cheaper = a < 0 || (b >= 0 && mst[b].weight() < mst[a].weight()) ? b : a;
+        if (cheaper < 0 || mst[cheaper].weight() >= chord.weight()) {
+            ++failures;
+        } else {
+            vector<Edge> swapped(mst);
+            int swappedCost = cost - swapped[cheaper].weight() + chord.weight();
+            swapped[cheaper] = chord;
+            if (MstVerifier::verify(snap, swapped, swappedCost, result) || result.defect != MstDefect::NOT_MINIMUM) {
+                ++failures;
+            }
+        }
+    }
+
+    cout << "Crescimento do tempo com 4x folhas: " << (ms[0] > 0 ? ms[1] / ms[0] : 0) << "x (informativo)\n";
+    cout << "Falhas: " << failures << "\n";
+    return failures == 0 ? 0 : 1;
+}
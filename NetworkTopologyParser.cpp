@@ -16,6 +16,8 @@
 #include <fstream>
 #include <sstream>
 #include <cctype>
+#include <cmath>
+#include <cstdlib>
 
 using namespace std;
 
@@ -26,13 +28,21 @@ static string trim(const string& s) {
     return s.substr(i, j - i);
 }
 
+static bool parseNumber(const string& token, double& out) {
+    char* end = nullptr;
+    out = strtod(token.c_str(), &end);
+    return !token.empty() && end == token.c_str() + token.size() && isfinite(out);
+}
+
 bool NetworkTopologyParser::parse(const string& path,
                                   vector<string>& outVertices,
                                   vector<Edge>& outEdges,
-                                  vector<string>* outErrors) {
+                                  vector<string>* outErrors,
+                                  vector<SiteCoord>* outSites) {
     outVertices.clear();
     outEdges.clear();
     if (outErrors) outErrors->clear();
+    if (outSites) outSites->clear();
 
     ifstream in(path);
     if (!in) {
@@ -60,6 +70,14 @@ bool NetworkTopologyParser::parse(const string& path,
                 if (outErrors) outErrors->push_back("Linha " + to_string(lineNo) + ": VERTEX sem chave.");
                 continue;
             }
+            // Coordenadas só quando seguem exatamente dois números; outros tokens extras continuam
+            // ignorados, como antes das coordenadas existirem.
+            vector<string> rest;
+            for (string tok; iss >> tok;) rest.push_back(tok);
+            double x = 0, y = 0;
+            if (outSites && rest.size() == 2 && parseNumber(rest[0], x) && parseNumber(rest[1], y)) {
+                outSites->push_back({key, x, y});
+            }
             outVertices.push_back(key);
             ++validCount;
         } else if (type == "EDGE") {
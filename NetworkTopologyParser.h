@@ -7,11 +7,11 @@
 * \brief Parser de topologia de rede a partir de arquivo texto.
 *
 * \details Formato esperado do arquivo:
-*   Linha iniciando com "VERTEX" seguida da chave do dispositivo.
+*   Linha iniciando com "VERTEX" seguida da chave do dispositivo e, opcionalmente, coordenadas x y.
 *   Linha iniciando com "EDGE" seguida de chaveA chaveB custo.
 *   Exemplo:
 *     VERTEX R1
-*     VERTEX R2
+*     VERTEX R2 120.5 -30
 *     EDGE R1 R2 10
 *
 * \pre O arquivo deve existir e seguir o formato descrito.
@@ -26,17 +26,27 @@
 #include "Edge.h"
 using namespace std;
 
+/** \brief Vértice com coordenadas planas (linha `VERTEX chave x y`). */
+struct SiteCoord {
+    string key;
+    double x;
+    double y;
+};
+
 class NetworkTopologyParser {
 public:
     /**
      * \brief Faz o parsing do arquivo de topologia com validações.
      * \pre `path` deve apontar para arquivo legível.
-     * \post Preenche `outVertices` e `outEdges`; retorna `true` se houve ao menos uma linha válida.
+     * \post Preenche `outVertices` e `outEdges`; com `outSites`, também os vértices seguidos de
+     *       exatamente dois números (demais tokens extras em VERTEX são ignorados, sem erro).
+     *       Retorna `true` se houve ao menos uma linha válida.
      */
     static bool parse(const string& path,
                       vector<string>& outVertices,
                       vector<Edge>& outEdges,
-                      vector<string>* outErrors = nullptr);
+                      vector<string>* outErrors = nullptr,
+                      vector<SiteCoord>* outSites = nullptr);
 };
 
 #endif
@@ -0,0 +1,175 @@
+/**
+* @file PartitionedMST.cpp
+* @authors
+*   Francisco Eduardo Fontenele - 15452569
+*   Vinicius Botte - 15522900
+*
+* \brief Implementação da MST particionada entre processos.
+*
+* \details Cada processo grava no seu pipe um cabeçalho (número de arestas e tempo gasto) seguido
+*          das arestas `IdEdge` da sua floresta e termina com `_exit`, sem destrutores (o `Graph`
+*          herdado não deve ser persistido pelo filho).
+*
+* \pre Sistema POSIX.
+* \post Nenhuma.
+*/
+
+#include "PartitionedMST.h"
+#include "KruskalMST.h"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <sys/wait.h>
+#include <unistd.h>
+using namespace std;
+
+/** \brief Cabeçalho enviado por processo antes da floresta. */
+struct ForestHeader {
+    uint64_t count;
+    double ms;
+};
+
+static bool writeAll(int fd, const void* data, size_t size) {
+    const char* p = static_cast<const char*>(data);
+    while (size > 0) {
+        ssize_t n = write(fd, p, size);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        p += n;
+        size -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+static bool readAll(int fd, void* data, size_t size) {
+    char* p = static_cast<char*>(data);
+    while (size > 0) {
+        ssize_t n = read(fd, p, size);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        p += n;
+        size -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+/**
+ * \brief Corpo do processo de trabalho: floresta mínima das arestas próprias de posição `[lo, hi)`.
+ * \pre Executado no filho após o `fork`; `prefix[u]` conta as arestas próprias dos ids menores que `u`.
+ * \post Retorna o código de saída do processo.
+ */
+static int runWorker(const GraphSnapshot& snap, const vector<size_t>& prefix, size_t lo, size_t hi, int fd) {
+    auto t0 = chrono::steady_clock::now();
+    const auto& ids = snap.neighborIds();
+    const auto& costs = snap.neighborCosts();
+    vector<IdEdge> edges;
+    edges.reserve(hi - lo);
+    int u = static_cast<int>(upper_bound(prefix.begin(), prefix.end(), lo) - prefix.begin()) - 1;
+    for (size_t rank = prefix[u]; u < snap.vertexCount() && rank < hi; ++u) {
+        for (int i = snap.begin(u); i < snap.end(u) && rank < hi; ++i) {
+            if (u >= ids[i]) continue;
+            if (rank >= lo) edges.push_back({costs[i], u, ids[i]});
+            ++rank;
+        }
+    }
+    vector<IdEdge> forest;
+    KruskalMST kruskal;
+    kruskal.computeForest(snap.vertexCount(), edges, forest);
+
+    ForestHeader header{forest.size(), chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count()};
+    bool ok = writeAll(fd, &header, sizeof header) && writeAll(fd, forest.data(), forest.size() * sizeof(IdEdge));
+    close(fd);
+    return ok ? 0 : 1;
+}
+
+bool PartitionedMST::compute(const GraphSnapshot& snap, int workers, vector<Edge>& outMst, int& outTotalCost,
+                             PartitionStats* stats, PhaseProfiler* profiler) {
+    outMst.clear();
+    outTotalCost = 0;
+    PartitionStats local;
+    PartitionStats& st = stats ? *stats : local;
+    st = PartitionStats();
+    st.workers = workers;
+
+    const int n = snap.vertexCount();
+    const auto& ids = snap.neighborIds();
+
+    // Arestas próprias (menor extremidade primeiro) em ordem de id, cortadas em faixas de mesmo
+    // tamanho. O corte pode cair no meio da linha de um vértice, então um hub (estrela) é dividido
+    // entre processos em vez de ficar inteiro com quem tem a sua menor extremidade.
+    size_t owned = 0;
+    vector<size_t> prefix(static_cast<size_t>(n) + 1, 0);
+    for (int u = 0; u < n; ++u) {
+        for (int i = snap.begin(u); i < snap.end(u); ++i) owned += u < ids[i];
+        prefix[u + 1] = owned;
+    }
+    vector<size_t> bounds(static_cast<size_t>(workers) + 1);
+    for (int k = 0; k <= workers; ++k) bounds[k] = owned * static_cast<size_t>(k) / static_cast<size_t>(workers);
+    st.ownedEdges = owned;
+    for (int k = 0; k < workers; ++k) st.maxWorkerEdges = max(st.maxWorkerEdges, bounds[k + 1] - bounds[k]);
+
+    vector<int> fds;
+    vector<pid_t> pids;
+    vector<IdEdge> merged;
+    bool ok = true;
+    {
+        PhaseScope phase(profiler, "particoes");
+        for (int k = 0; k < workers && ok; ++k) {
+            int p[2];
+            if (pipe(p) != 0) { ok = false; break; }
+            pid_t pid = fork();
+            if (pid < 0) {
+                close(p[0]);
+                close(p[1]);
+                ok = false;
+                break;
+            }
+            if (pid == 0) {
+                close(p[0]);
+                for (int fd : fds) close(fd);
+                _exit(runWorker(snap, prefix, bounds[k], bounds[k + 1], p[1]));
+            }
+            close(p[1]);
+            fds.push_back(p[0]);
+            pids.push_back(pid);
+        }
+
+        for (int fd : fds) {
+            ForestHeader header{0, 0};
+            // Uma floresta tem no máximo V - 1 arestas; mais que isso é cabeçalho corrompido.
+            if (ok && readAll(fd, &header, sizeof header) && header.count <= static_cast<uint64_t>(max(n - 1, 0))) {
+                size_t at = merged.size();
+                merged.resize(at + header.count);
+                ok = readAll(fd, merged.data() + at, header.count * sizeof(IdEdge));
+                st.edgesSent += header.count;
+                st.bytesSent += sizeof header + header.count * sizeof(IdEdge);
+                if (header.ms > st.workerMs) st.workerMs = header.ms;
+            } else {
+                ok = false;
+            }
+            close(fd);
+        }
+        for (pid_t pid : pids) {
+            int status = 0;
+            while (waitpid(pid, &status, 0) < 0 && errno == EINTR) {}
+            if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) ok = false;
+        }
+    }
+    if (!ok) return false;
+
+    auto t0 = chrono::steady_clock::now();
+    {
+        PhaseScope phase(profiler, "juncao");
+        vector<IdEdge> forest;
+        KruskalMST kruskal;
+        kruskal.computeForest(n, merged, forest);
+        outMst.reserve(forest.size());
+        for (const auto& e : forest) {
+            outMst.push_back(snap.makeEdge(e.u, e.v, e.w));
+            outTotalCost += e.w;
+        }
+    }
+    st.mergeMs = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+    return true;
+}
@@ -0,0 +1,60 @@
+/**
+* @file PartitionedMST.h
+* @authors
+*   Francisco Eduardo Fontenele - 15452569
+*   Vinicius Botte - 15522900
+*
+* \brief MST particionada entre processos de trabalho (fork + pipes).
+*
+* \details Cada aresta pertence à sua menor extremidade; percorridas em ordem de id, as arestas são
+*          cortadas em faixas contíguas com o mesmo número de arestas, mesmo que o corte caia no meio
+*          da lista de um vértice (hubs são divididos entre processos). Cada processo calcula a
+*          floresta mínima das suas arestas e envia só ela pelo pipe; arestas descartadas fecham
+*          ciclo no subconjunto e, pela propriedade do ciclo, também no grafo todo. O coordenador
+*          junta as florestas com um Kruskal final. Os processos herdam o snapshot por `fork`
+*          (páginas compartilhadas, sem cópia) e o coordenador nunca monta a lista completa de arestas.
+*
+* \pre Sistema POSIX.
+* \post Mesma floresta mínima (em custo) de `KruskalMST::compute`.
+*/
+
+#ifndef PARTITIONED_MST_H
+#define PARTITIONED_MST_H
+
+#include <cstddef>
+#include <vector>
+#include "Graph.h"
+#include "Edge.h"
+#include "PhaseProfiler.h"
+using namespace std;
+
+/**
+ * \brief Estatísticas de uma execução particionada.
+ * \details `edgesSent`/`bytesSent` contam o que atravessou os pipes (florestas e cabeçalhos);
+ *          `workerMs` é o tempo do processo mais lento (extração, ordenação e Union-Find);
+ *          `maxWorkerEdges` é a maior faixa, para comparar com a média `ownedEdges / workers`.
+ */
+struct PartitionStats {
+    int workers = 0;
+    size_t ownedEdges = 0;
+    size_t maxWorkerEdges = 0;
+    size_t edgesSent = 0;
+    size_t bytesSent = 0;
+    double workerMs = 0;
+    double mergeMs = 0;
+};
+
+class PartitionedMST {
+public:
+    /**
+     * \brief Calcula a MST com `workers` processos e uma junção final no processo chamador.
+     * \pre `workers >= 1`; nenhuma outra thread deve alterar o estado global durante o `fork`.
+     * \post Retorna falso se não foi possível criar pipes/processos, se algum processo falhou ou se
+     *       enviou mais de V - 1 arestas.
+     * \details Com `profiler`, registra as fases "particoes" (processos) e "juncao" (Kruskal final e saída).
+     */
+    static bool compute(const GraphSnapshot& snap, int workers, vector<Edge>& outMst, int& outTotalCost,
+                        PartitionStats* stats = nullptr, PhaseProfiler* profiler = nullptr);
+};
+
+#endif
@@ -0,0 +1,91 @@
+/**
+* @file PerfCounters.cpp
+* @authors
+*   Francisco Eduardo Fontenele - 15452569
+*   Vinicius Botte - 15522900
+*
+* \brief Implementação dos contadores de hardware.
+*
+* \details Cada leitura devolve `{valor, tempo habilitado, tempo em execução}`
+*          (`PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING`).
+*
+* \pre Nenhuma.
+* \post Nenhuma.
+*/
+
+#include "PerfCounters.h"
+#ifdef __linux__
+#include <cerrno>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+using namespace std;
+
+#ifdef __linux__
+static const uint64_t EVENTS[PerfCounters::COUNT] = {
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_MISSES,
+    PERF_COUNT_HW_BRANCH_MISSES,
+};
+
+static int openCounter(uint64_t config) {
+    perf_event_attr attr;
+    memset(&attr, 0, sizeof attr);
+    attr.size = sizeof attr;
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+PerfCounters::PerfCounters() {
+    for (int k = 0; k < COUNT; ++k) {
+        fds[k] = openCounter(EVENTS[k]);
+        if (fds[k] < 0 && reason.empty()) reason = string("perf_event_open: ") + strerror(errno);
+    }
+}
+
+PerfCounters::~PerfCounters() {
+    for (int fd : fds) {
+        if (fd >= 0) close(fd);
+    }
+}
+
+void PerfCounters::read(uint64_t out[COUNT]) const {
+    for (int k = 0; k < COUNT; ++k) {
+        uint64_t buf[3] = {0, 0, 0};
+        out[k] = 0;
+        if (fds[k] < 0 || ::read(fds[k], buf, sizeof buf) != static_cast<ssize_t>(sizeof buf)) continue;
+        out[k] = buf[2] > 0 && buf[2] < buf[1]
+                     ? static_cast<uint64_t>(static_cast<double>(buf[0]) * buf[1] / buf[2])
+                     : buf[0];
+    }
+}
+#else
+PerfCounters::PerfCounters() : reason("perf_event_open disponivel apenas no Linux") {
+    for (int k = 0; k < COUNT; ++k) fds[k] = -1;
+}
+
+PerfCounters::~PerfCounters() {}
+
+void PerfCounters::read(uint64_t out[COUNT]) const {
+    for (int k = 0; k < COUNT; ++k) out[k] = 0;
+}
+#endif
+
+bool PerfCounters::available() const {
+    for (int fd : fds) {
+        if (fd >= 0) return true;
+    }
+    return false;
+}
+
+const char* PerfCounters::name(int k) {
+    static const char* const NAMES[COUNT] = {"ciclos", "instrucoes", "cache-misses", "branch-misses"};
+    return NAMES[k];
+}
@@ -0,0 +1,89 @@
+/**
+* @file PerfCounters.h
+* @authors
+*   Francisco Eduardo Fontenele - 15452569
+*   Vinicius Botte - 15522900
+*
+* \brief Contadores de hardware (ciclos, instruções, cache misses, branch misses) via `perf_event_open`.
+*
+* \details Um descritor por contador, medindo só a thread que os abriu e só em modo usuário
+*          (funciona com `perf_event_paranoid <= 2`). Os contadores ficam ligados desde a abertura;
+*          uma fase é a diferença entre duas leituras. Valores multiplexados pelo kernel são
+*          escalados por `tempo habilitado / tempo em execução`. Fora do Linux, ou sem PMU
+*          (máquinas virtuais, contêineres), nenhum contador abre e `available()` é falso.
+*
+* \pre Nenhuma.
+* \post Descritores fechados no destrutor.
+*/
+
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include <cstdint>
+#include <string>
+using namespace std;
+
+class PerfCounters {
+public:
+    /** \brief Número de contadores: ciclos, instruções, cache misses e branch misses, nessa ordem. */
+    static constexpr int COUNT = 4;
+
+private:
+    int fds[COUNT];
+    string reason;
+
+public:
+    /**
+     * \brief Abre os contadores da thread corrente.
+     * \pre Nenhuma.
+     * \post Contadores que falharem ficam indisponíveis; `status()` guarda o primeiro erro.
+     */
+    PerfCounters();
+
+    /**
+     * \brief Fecha os descritores abertos.
+     * \pre Nenhuma.
+     * \post Nenhuma.
+     */
+    ~PerfCounters();
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    /**
+     * \brief Indica se ao menos um contador está aberto.
+     * \pre Nenhuma.
+     * \post Nenhuma.
+     */
+    bool available() const;
+
+    /**
+     * \brief Indica se o contador `k` está aberto.
+     * \pre `0 <= k < COUNT`.
+     * \post Nenhuma.
+     */
+    bool has(int k) const { return fds[k] >= 0; }
+
+    /**
+     * \brief Motivo da indisponibilidade (vazio se todos abriram).
+     * \pre Nenhuma.
+     * \post Texto curto para a CLI.
+     */
+    const string& status() const { return reason; }
+
+    /**
+     * \brief Lê os totais acumulados desde a abertura.
+     * \pre `out` com `COUNT` posições.
+     * \post Contadores indisponíveis (ou que falharem na leitura) valem zero.
+     */
+    void read(uint64_t out[COUNT]) const;
+
+    /**
+     * \brief Nome do contador `k` no relatório.
+     * \pre `0 <= k < COUNT`.
+     * \post Texto estático.
+     */
+    static const char* name(int k);
+};
+
+#endif
@@ -0,0 +1,52 @@
+/**
+* @file PhaseProfiler.cpp
+* @authors
+*   Francisco Eduardo Fontenele - 15452569
+*   Vinicius Botte - 15522900
+*
+* \brief Implementação do acumulador de tempos por fase.
+*
+* \details Poucas fases por execução: busca linear pelo nome é suficiente.
+*
+* \pre Nenhuma.
+* \post Relatório textual estável.
+*/
+
+#include "PhaseProfiler.h"
+using namespace std;
+
+bool PhaseProfiler::enableCounters(string* reason) {
+    perf.reset(new PerfCounters());
+    if (perf->available()) return true;
+    if (reason) *reason = perf->status();
+    perf.reset();
+    return false;
+}
+
+void PhaseProfiler::add(const string& name, double ms, const uint64_t* deltas) {
+    Phase* phase = nullptr;
+    for (auto& p : phases) {
+        if (p.name == name) phase = &p;
+    }
+    if (!phase) {
+        phases.push_back({name, 0, 0});
+        phase = &phases.back();
+    }
+    phase->ms += ms;
+    ++phase->calls;
+    for (int k = 0; deltas && k < PerfCounters::COUNT; ++k) phase->counters[k] += deltas[k];
+}
+
+void PhaseProfiler::print(ostream& out) const {
+    for (const auto& p : phases) {
+        out << "  " << p.name << ": " << p.ms << " ms (" << p.calls << "x)";
+        for (int k = 0; perf && k < PerfCounters::COUNT; ++k) {
+            if (!perf->has(k)) continue;
+            out << ", " << PerfCounters::name(k) << " " << p.counters[k];
+            if (k == 1 && perf->has(0) && p.counters[0] > 0) {
+                out << " (IPC " << static_cast<double>(p.counters[1]) / static_cast<double>(p.counters[0]) << ")";
+            }
+        }
+        out << "\n";
+    }
+}
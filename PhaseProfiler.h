@@ -0,0 +1,131 @@
+/**
+* @file PhaseProfiler.h
+* @authors
+*   Francisco Eduardo Fontenele - 15452569
+*   Vinicius Botte - 15522900
+*
+* \brief Medição de tempo por fase dos caminhos críticos (carga, ordenação, Union-Find, ...).
+*
+* \details Cada fase é aberta com `PhaseScope` (RAII) e acumulada pelo nome; fases repetidas somam
+*          tempo e contagem. O relatório tem uma linha por fase no formato
+*          `  <fase>: <ms> ms (<n>x)`, na ordem em que as fases apareceram pela primeira vez.
+*          Com `enableCounters`, cada linha ganha os contadores de hardware da fase
+*          (`, ciclos <n>, instrucoes <n> (IPC <x>), cache-misses <n>, branch-misses <n>`); sem
+*          contadores disponíveis o relatório é só de tempos.
+*
+* \pre Uso por uma única thread por instância.
+* \post Relatório impresso sob demanda.
+*/
+
+#ifndef PHASE_PROFILER_H
+#define PHASE_PROFILER_H
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "PerfCounters.h"
+using namespace std;
+
+class PhaseProfiler {
+public:
+    struct Phase {
+        string name;
+        double ms = 0;
+        int calls = 0;
+        uint64_t counters[PerfCounters::COUNT] = {};
+    };
+
+private:
+    vector<Phase> phases;
+    unique_ptr<PerfCounters> perf;
+
+public:
+    /**
+     * \brief Liga os contadores de hardware para as próximas fases.
+     * \pre Chamado pela thread que abrirá as fases (os contadores medem só ela).
+     * \post Retorna falso e preenche `reason` se nenhum contador estiver disponível; nesse caso
+     *       o profiler continua só com tempos.
+     */
+    bool enableCounters(string* reason = nullptr);
+
+    /**
+     * \brief Contadores ativos, ou nulo se desligados/indisponíveis.
+     * \pre Nenhuma.
+     * \post Nenhuma.
+     */
+    const PerfCounters* counters() const { return perf.get(); }
+
+    /**
+     * \brief Acumula a duração (e, se houver, os contadores) de uma execução da fase.
+     * \pre `ms >= 0`; `deltas` nulo ou com `PerfCounters::COUNT` posições.
+     * \post Cria a fase se ainda não existir.
+     */
+    void add(const string& name, double ms, const uint64_t* deltas = nullptr);
+
+    /**
+     * \brief Fases registradas, na ordem de primeira ocorrência.
+     * \pre Nenhuma.
+     * \post Referência válida até a próxima alteração.
+     */
+    const vector<Phase>& results() const { return phases; }
+
+    /**
+     * \brief Descarta as medições.
+     * \pre Nenhuma.
+     * \post Nenhuma fase registrada.
+     */
+    void clear() { phases.clear(); }
+
+    /**
+     * \brief Imprime o relatório, uma linha por fase.
+     * \pre Fluxo de saída válido.
+     * \post Linhas `  <fase>: <ms> ms (<n>x)`, seguidas dos contadores disponíveis.
+     */
+    void print(ostream& out) const;
+};
+
+class PhaseScope {
+private:
+    PhaseProfiler* profiler;
+    string name;
+    chrono::steady_clock::time_point start;
+    uint64_t begin[PerfCounters::COUNT] = {};
+
+public:
+    /**
+     * \brief Abre a fase; `profiler` nulo desativa a medição sem custo relevante.
+     * \pre Nenhuma.
+     * \post Cronômetro iniciado.
+     */
+    PhaseScope(PhaseProfiler* p, const string& phase)
+        : profiler(p), name(p ? phase : string()) {
+        if (p && p->counters()) p->counters()->read(begin);
+        if (p) start = chrono::steady_clock::now();
+    }
+
+    /**
+     * \brief Fecha a fase e acumula a duração.
+     * \pre Nenhuma.
+     * \post Duração registrada no profiler, se houver.
+     */
+    ~PhaseScope() {
+        if (!profiler) return;
+        double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        if (!profiler->counters()) {
+            profiler->add(name, ms);
+            return;
+        }
+        uint64_t end[PerfCounters::COUNT];
+        profiler->counters()->read(end);
+        for (int k = 0; k < PerfCounters::COUNT; ++k) end[k] = end[k] >= begin[k] ? end[k] - begin[k] : 0;
+        profiler->add(name, ms, end);
+    }
+
+    PhaseScope(const PhaseScope&) = delete;
+    PhaseScope& operator=(const PhaseScope&) = delete;
+};
+
+#endif
@@ -0,0 +1,149 @@
+/**
+* @file QueryProtocol.h
+* @authors
+*   Francisco Eduardo Fontenele - 15452569
+*   Vinicius Botte - 15522900
+*
+* \brief Protocolo binário compacto do servidor de consultas (socket Unix local).
+*
+* \details Quadro de requisição: `u32 tamanho`, `u32 id`, `u8 operação`, carga.
+*          Quadro de resposta:   `u32 tamanho`, `u32 id`, `u8 status`, carga.
+*          `tamanho` conta os bytes após o próprio campo. Strings são `u32 len` + bytes; inteiros em
+*          ordem de bytes do host (cliente e servidor rodam na mesma máquina). O `id` é escolhido pelo
+*          cliente e devolvido na resposta; em uma conexão, as respostas seguem a ordem dos pedidos.
+*
+*          Cargas por operação (requisição -> resposta com status OK):
+*            PING            -> (vazio)
+*            HAS_VERTEX  k   -> (vazio)            NOT_FOUND se não existir
+*            HAS_EDGE  a b   -> i32 custo          NOT_FOUND se não existir
+*            INSERT_VERTEX k / DELETE_VERTEX k / DELETE_EDGE a b -> (vazio)
+*            INSERT_EDGE a b i32 custo             -> (vazio)
+*            MST             -> i32 custo total, u32 n, n x (str u, str v, i32 w)
+*            EXPORT prefixo  -> (vazio); grava prefixo+graph_vertices.txt, graph_edges.txt, mst_edges.txt
+*                               no diretório do servidor (prefixo com '/' ou '\\' -> FAILED)
+*            VERTICES        -> u32 n, n x str
+*            SHUTDOWN        -> (vazio); servidor encerra e persiste o grafo
+*
+* \pre Cliente e servidor compilados na mesma arquitetura.
+* \post Codificação e decodificação sem alocação por campo além das strings.
+*/
+
+#ifndef QUERY_PROTOCOL_H
+#define QUERY_PROTOCOL_H
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+using namespace std;
+
+enum class QueryOp : uint8_t {
+    PING = 1,
+    HAS_VERTEX = 2,
+    HAS_EDGE = 3,
+    INSERT_VERTEX = 4,
+    INSERT_EDGE = 5,
+    DELETE_VERTEX = 6,
+    DELETE_EDGE = 7,
+    MST = 8,
+    EXPORT = 9,
+    VERTICES = 10,
+    SHUTDOWN = 11
+};
+
+enum class QueryStatus : uint8_t {
+    OK = 0,
+    NOT_FOUND = 1,
+    FAILED = 2
+};
+
+/** \brief Tamanho do cabeçalho após o campo de tamanho: `u32 id` + `u8 op/status`. */
+static constexpr size_t QUERY_HEADER = 5;
+
+/** \brief Limite de tamanho de quadro aceito pelo servidor (proteção contra lixo no socket). */
+static constexpr uint32_t QUERY_MAX_FRAME = 64u * 1024u * 1024u;
+
+class FrameWriter {
+private:
+    vector<uint8_t>& buf;
+    size_t start;
+
+    void raw(const void* p, size_t n) {
+        const uint8_t* b = static_cast<const uint8_t*>(p);
+        buf.insert(buf.end(), b, b + n);
+    }
+
+public:
+    /**
+     * \brief Inicia um quadro no final de `out`.
+     * \pre `out` pode conter quadros anteriores.
+     * \post Cabeçalho escrito; o tamanho é corrigido em `finish`.
+     */
+    FrameWriter(vector<uint8_t>& out, uint32_t id, uint8_t code) : buf(out), start(out.size()) {
+        u32(0);
+        u32(id);
+        u8(code);
+    }
+
+    void u8(uint8_t v) { buf.push_back(v); }
+    void u16(uint16_t v) { raw(&v, sizeof v); }
+    void u32(uint32_t v) { raw(&v, sizeof v); }
+    void i32(int32_t v) { raw(&v, sizeof v); }
+    void str(const string& s) {
+        u32(static_cast<uint32_t>(s.size()));
+        raw(s.data(), s.size());
+    }
+
+    /**
+     * \brief Fecha o quadro gravando o tamanho.
+     * \pre Chamado uma única vez após escrever a carga.
+     * \post O quadro está pronto para envio.
+     */
+    void finish() {
+        uint32_t len = static_cast<uint32_t>(buf.size() - start - sizeof(uint32_t));
+        memcpy(&buf[start], &len, sizeof len);
+    }
+};
+
+class FrameReader {
+private:
+    const uint8_t* p;
+    const uint8_t* end;
+    bool good = true;
+
+    bool take(void* out, size_t n) {
+        if (!good || static_cast<size_t>(end - p) < n) { good = false; return false; }
+        memcpy(out, p, n);
+        p += n;
+        return true;
+    }
+
+public:
+    /**
+     * \brief Lê a carga de um quadro já delimitado.
+     * \pre `[data, data + n)` deve conter apenas a carga.
+     * \post Leituras além do fim marcam o leitor como inválido.
+     */
+    FrameReader(const uint8_t* data, size_t n) : p(data), end(data + n) {}
+
+    uint8_t u8() { uint8_t v = 0; take(&v, sizeof v); return v; }
+    uint16_t u16() { uint16_t v = 0; take(&v, sizeof v); return v; }
+    uint32_t u32() { uint32_t v = 0; take(&v, sizeof v); return v; }
+    int32_t i32() { int32_t v = 0; take(&v, sizeof v); return v; }
+    string str() {
+        uint32_t n = u32();
+        if (!good || static_cast<size_t>(end - p) < n) { good = false; return string(); }
+        string s(reinterpret_cast<const char*>(p), n);
+        p += n;
+        return s;
+    }
+
+    /**
+     * \brief Indica se todas as leituras couberam na carga.
+     * \pre Nenhuma.
+     * \post Retorna falso se alguma leitura foi truncada.
+     */
+    bool ok() const { return good; }
+};
+
+#endif
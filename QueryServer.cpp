@@ -0,0 +1,352 @@
+/**
+* @file QueryServer.cpp
+* @authors
+*   Francisco Eduardo Fontenele - 15452569
+*   Vinicius Botte - 15522900
+*
+* \brief Implementação do servidor de consultas por socket Unix.
+*
+* \details Laço único de `poll` para E/S não bloqueante; execução das requisições no pool.
+*          Um pipe de despertar avisa o laço quando há respostas a enviar.
+*
+* \pre Sistema POSIX.
+* \post Requisições atendidas concorrentemente até o encerramento.
+*/
+
+#include "QueryServer.h"
+#include "QueryProtocol.h"
+#include "KruskalMST.h"
+#include "SimpleExporter.h"
+#include <cerrno>
+#include <chrono>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+using namespace std;
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+static void setNonBlocking(int fd) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+}
+
+// Escritas cujo resultado não depende de alterações do mesmo tipo ainda não publicadas (INSERT_EDGE
+// só consulta vértices): uma sequência de pedidos iguais pode formar um lote do grafo.
+static bool batchable(uint8_t op) {
+    switch (static_cast<QueryOp>(op)) {
+    case QueryOp::INSERT_VERTEX:
+    case QueryOp::INSERT_EDGE:
+    case QueryOp::DELETE_VERTEX:
+    case QueryOp::DELETE_EDGE:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Prefixo de EXPORT vindo do cliente: sem separadores de caminho (nem NUL), os arquivos só podem
+// ser gravados no diretório de trabalho do servidor.
+static bool safePrefix(const string& prefix) {
+    return prefix.find_first_of(string("/\\\0", 3)) == string::npos;
+}
+
+QueryServer::QueryServer(Graph& g, const string& path, unsigned threads)
+    : graph(g), socketPath(path), pool(threads) {}
+
+QueryServer::~QueryServer() {
+    pool.wait();
+    for (auto& kv : connections) close(kv.first);
+    if (listenFd >= 0) {
+        close(listenFd);
+        unlink(socketPath.c_str());
+    }
+    if (wakeRead >= 0) close(wakeRead);
+    if (wakeWrite >= 0) close(wakeWrite);
+}
+
+void QueryServer::wake() {
+    char b = 1;
+    ssize_t r = write(wakeWrite, &b, 1);
+    (void)r;
+}
+
+void QueryServer::stop() {
+    stopping = true;
+    if (wakeWrite >= 0) wake();
+}
+
+bool QueryServer::flush(Connection& c) {
+    lock_guard<mutex> lk(c.outMutex);
+    size_t sent = 0;
+    while (sent < c.out.size()) {
+        ssize_t n = send(c.fd, c.out.data() + sent, c.out.size() - sent, MSG_NOSIGNAL);
+        if (n > 0) { sent += static_cast<size_t>(n); continue; }
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+        if (n < 0 && errno == EINTR) continue;
+        return false;
+    }
+    c.out.erase(c.out.begin(), c.out.begin() + static_cast<ptrdiff_t>(sent));
+    return true;
+}
+
+void QueryServer::drain() {
+    auto deadline = chrono::steady_clock::now() + chrono::milliseconds(DRAIN_MS);
+    for (auto& kv : connections) {
+        Connection& c = *kv.second;
+        while (flush(c)) {
+            {
+                lock_guard<mutex> lk(c.outMutex);
+                if (c.out.empty()) break;
+            }
+            auto left = chrono::duration_cast<chrono::milliseconds>(deadline - chrono::steady_clock::now()).count();
+            if (left <= 0) return;
+            pollfd p{c.fd, POLLOUT, 0};
+            if (poll(&p, 1, static_cast<int>(left)) < 0 && errno != EINTR) break;
+        }
+    }
+}
+
+bool QueryServer::dispatch(const shared_ptr<Connection>& c) {
+    size_t pos = 0;
+    while (c->in.size() - pos >= sizeof(uint32_t) + QUERY_HEADER) {
+        uint32_t len = 0, id = 0;
+        memcpy(&len, &c->in[pos], sizeof len);
+        if (len < QUERY_HEADER || len > QUERY_MAX_FRAME) return false;
+        if (c->in.size() - pos < sizeof(uint32_t) + len) break;
+        memcpy(&id, &c->in[pos + 4], sizeof id);
+        uint8_t op = c->in[pos + 8];
+        auto first = c->in.begin() + static_cast<ptrdiff_t>(pos + 9);
+        bool start = false;
+        {
+            lock_guard<mutex> lk(c->queueMutex);
+            c->queue.push_back({id, op, vector<uint8_t>(first, first + static_cast<ptrdiff_t>(len - QUERY_HEADER))});
+            start = !c->busy;
+            c->busy = true;
+        }
+        if (start) pool.submit([this, c] { serve(c); });
+        pos += sizeof(uint32_t) + len;
+    }
+    c->in.erase(c->in.begin(), c->in.begin() + static_cast<ptrdiff_t>(pos));
+    return true;
+}
+
+void QueryServer::serve(const shared_ptr<Connection>& c) {
+    vector<Request> run;
+    {
+        lock_guard<mutex> lk(c->queueMutex);
+        do {
+            run.push_back(std::move(c->queue.front()));
+            c->queue.pop_front();
+        } while (batchable(run[0].op) && run.size() < WRITE_BATCH && !c->queue.empty()
+                 && c->queue.front().op == run[0].op);
+    }
+    vector<uint8_t> reply;
+    if (run.size() > 1) graph.beginBatch();
+    for (const Request& r : run) handle(r, reply);
+    // Publica antes de responder: quem recebe a resposta (por qualquer conexão) vê a alteração.
+    if (run.size() > 1) graph.endBatch();
+    {
+        lock_guard<mutex> lk(c->outMutex);
+        c->out.insert(c->out.end(), reply.begin(), reply.end());
+    }
+    served += run.size();
+    wake();
+    // Um pedido (ou lote) por tarefa: a conexão volta ao fim das filas do pool, sem monopolizar um worker.
+    {
+        lock_guard<mutex> lk(c->queueMutex);
+        if (c->queue.empty()) {
+            c->busy = false;
+            return;
+        }
+    }
+    pool.submit([this, c] { serve(c); });
+}
+
+void QueryServer::handle(const Request& r, vector<uint8_t>& reply) {
+    FrameReader in(r.payload.data(), r.payload.size());
+    size_t start = reply.size();
+    FrameWriter out(reply, r.id, static_cast<uint8_t>(QueryStatus::OK));
+    QueryStatus status = QueryStatus::OK;
+
+    switch (static_cast<QueryOp>(r.op)) {
+    case QueryOp::PING:
+        break;
+    case QueryOp::HAS_VERTEX: {
+        string k = in.str();
+        if (in.ok() && !graph.hasVertex(k)) status = QueryStatus::NOT_FOUND;
+        break;
+    }
+    case QueryOp::HAS_EDGE: {
+        string a = in.str();
+        string b = in.str();
+        int cost = 0;
+        if (in.ok() && graph.hasEdge(a, b, &cost)) out.i32(cost);
+        else status = QueryStatus::NOT_FOUND;
+        break;
+    }
+    case QueryOp::INSERT_VERTEX: {
+        string k = in.str();
+        if (in.ok() && !k.empty()) graph.insertVertex(k);
+        else status = QueryStatus::FAILED;
+        break;
+    }
+    case QueryOp::INSERT_EDGE: {
+        string a = in.str();
+        string b = in.str();
+        int32_t w = in.i32();
+        if (!in.ok() || a == b || w < 0) { status = QueryStatus::FAILED; break; }
+        if (!graph.hasVertex(a) || !graph.hasVertex(b)) { status = QueryStatus::NOT_FOUND; break; }
+        graph.insertEdge(a, b, w);
+        break;
+    }
+    case QueryOp::DELETE_VERTEX: {
+        string k = in.str();
+        if (in.ok()) graph.deleteVertex(k);
+        break;
+    }
+    case QueryOp::DELETE_EDGE: {
+        string a = in.str();
+        string b = in.str();
+        if (in.ok()) graph.deleteUndirectedEdge(a, b);
+        break;
+    }
+    case QueryOp::MST: {
+        vector<Edge> mst;
+        int total = 0;
+        KruskalMST kruskal;
+        kruskal.compute(*graph.snapshot(), mst, total);
+        out.i32(total);
+        out.u32(static_cast<uint32_t>(mst.size()));
+        for (const auto& e : mst) {
+            out.str(e.u());
+            out.str(e.v());
+            out.i32(e.weight());
+        }
+        break;
+    }
+    case QueryOp::EXPORT: {
+        string prefix = in.str();
+        if (!in.ok() || !safePrefix(prefix)) { status = QueryStatus::FAILED; break; }
+        auto snap = graph.snapshot();
+        vector<Edge> mst;
+        int total = 0;
+        KruskalMST kruskal;
+        kruskal.compute(*snap, mst, total);
+        bool ok = SimpleExporter::exportVertices(*snap, prefix + "graph_vertices.txt")
+               && SimpleExporter::exportEdges(*snap, prefix + "graph_edges.txt")
+               && SimpleExporter::exportMst(mst, prefix + "mst_edges.txt");
+        if (!ok) status = QueryStatus::FAILED;
+        break;
+    }
+    case QueryOp::VERTICES: {
+        auto snap = graph.snapshot();
+        out.u32(static_cast<uint32_t>(snap->vertexCount()));
+        for (int i = 0; i < snap->vertexCount(); ++i) out.str(snap->keyOf(i));
+        break;
+    }
+    case QueryOp::SHUTDOWN:
+        stopping = true;
+        break;
+    default:
+        status = QueryStatus::FAILED;
+        break;
+    }
+    if (!in.ok()) status = QueryStatus::FAILED;
+
+    if (status != QueryStatus::OK) reply.resize(start + sizeof(uint32_t) + QUERY_HEADER);
+    reply[start + 2 * sizeof(uint32_t)] = static_cast<uint8_t>(status);
+    out.finish();
+}
+
+bool QueryServer::run() {
+    int pipeFds[2];
+    if (pipe(pipeFds) != 0) return false;
+    wakeRead = pipeFds[0];
+    wakeWrite = pipeFds[1];
+    setNonBlocking(wakeRead);
+    setNonBlocking(wakeWrite);
+
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    if (socketPath.size() >= sizeof(addr.sun_path)) return false;
+    memcpy(addr.sun_path, socketPath.c_str(), socketPath.size() + 1);
+    unlink(socketPath.c_str());
+
+    listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listenFd < 0) return false;
+    if (bind(listenFd, reinterpret_cast<sockaddr*>(&addr), sizeof addr) != 0 || listen(listenFd, 128) != 0) {
+        close(listenFd);
+        listenFd = -1;
+        return false;
+    }
+    setNonBlocking(listenFd);
+
+    vector<pollfd> fds;
+    while (!stopping) {
+        fds.clear();
+        fds.push_back({listenFd, POLLIN, 0});
+        fds.push_back({wakeRead, POLLIN, 0});
+        for (auto& kv : connections) {
+            short events = POLLIN;
+            {
+                lock_guard<mutex> lk(kv.second->outMutex);
+                if (!kv.second->out.empty()) events |= POLLOUT;
+            }
+            fds.push_back({kv.first, events, 0});
+        }
+
+        if (poll(fds.data(), fds.size(), -1) < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+
+        if (fds[1].revents & POLLIN) {
+            char drain[256];
+            while (read(wakeRead, drain, sizeof drain) > 0) {}
+            for (auto& kv : connections) flush(*kv.second);
+        }
+
+        if (fds[0].revents & POLLIN) {
+            int fd;
+            while ((fd = accept(listenFd, nullptr, nullptr)) >= 0) {
+                setNonBlocking(fd);
+                auto c = make_shared<Connection>();
+                c->fd = fd;
+                connections[fd] = c;
+            }
+        }
+
+        for (size_t i = 2; i < fds.size(); ++i) {
+            auto it = connections.find(fds[i].fd);
+            if (it == connections.end()) continue;
+            auto c = it->second;
+            bool alive = true;
+            if (fds[i].revents & (POLLIN | POLLHUP | POLLERR)) {
+                uint8_t buf[64 * 1024];
+                while (true) {
+                    ssize_t n = recv(c->fd, buf, sizeof buf, 0);
+                    if (n > 0) { c->in.insert(c->in.end(), buf, buf + n); continue; }
+                    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+                    if (n < 0 && errno == EINTR) continue;
+                    alive = false;
+                    break;
+                }
+                if (!dispatch(c)) alive = false;
+            }
+            if (alive && (fds[i].revents & POLLOUT)) alive = flush(*c);
+            if (!alive) {
+                close(c->fd);
+                connections.erase(it);
+            }
+        }
+    }
+
+    pool.wait();
+    drain();
+    return true;
+}
@@ -0,0 +1,156 @@
+/**
+* @file QueryServer.h
+* @authors
+*   Francisco Eduardo Fontenele - 15452569
+*   Vinicius Botte - 15522900
+*
+* \brief Servidor local que mantém o grafo residente e atende consultas por socket Unix.
+*
+* \details Evita o custo de `readGraph`/`writeGraph` a cada consulta rápida. Um laço `poll` aceita
+*          conexões e recorta quadros (`QueryProtocol.h`). Cada conexão tem uma fila própria com no
+*          máximo uma tarefa em execução no `WorkStealingPool`: pedidos em pipeline de um cliente são
+*          atendidos um a um, na ordem de chegada (cada um vê as alterações dos anteriores e as
+*          respostas saem na mesma ordem), enquanto conexões distintas rodam em paralelo. Leituras
+*          usam snapshots do grafo; alterações passam pelos métodos thread-safe de `Graph`. Uma
+*          sequência de pedidos de escrita iguais já enfileirados (ex.: vários `INSERT_EDGE`) vira um
+*          lote do grafo, publicado uma vez antes das respostas.
+*
+* \pre Sistema POSIX com sockets `AF_UNIX`.
+* \post O grafo é persistido pelo dono do `Graph` quando o servidor retorna.
+*/
+
+#ifndef QUERY_SERVER_H
+#define QUERY_SERVER_H
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "Graph.h"
+#include "WorkStealingPool.h"
+using namespace std;
+
+class QueryServer {
+private:
+    struct Request {
+        uint32_t id;
+        uint8_t op;
+        vector<uint8_t> payload;
+    };
+
+    struct Connection {
+        int fd = -1;
+        vector<uint8_t> in;
+        mutex outMutex;
+        vector<uint8_t> out;
+        mutex queueMutex;
+        deque<Request> queue;
+        bool busy = false;
+    };
+
+    Graph& graph;
+    string socketPath;
+    WorkStealingPool pool;
+    map<int, shared_ptr<Connection>> connections;
+    int listenFd = -1;
+    int wakeRead = -1;
+    int wakeWrite = -1;
+    atomic<bool> stopping{false};
+    atomic<uint64_t> served{0};
+
+    /**
+     * \brief Acorda o laço de eventos (respostas prontas ou pedido de parada).
+     * \pre Pipe de despertar criado.
+     * \post O `poll` retorna na próxima iteração.
+     */
+    void wake();
+
+    /**
+     * \brief Recorta quadros completos do buffer de entrada e os enfileira na conexão.
+     * \pre `c->in` contém bytes recebidos.
+     * \post Quadros consumidos são removidos do buffer; agenda `serve` se a conexão estava ociosa;
+     *       retorna falso se o quadro for inválido.
+     */
+    bool dispatch(const shared_ptr<Connection>& c);
+
+    /** \brief Máximo de escritas iguais consecutivas atendidas em um único lote do grafo. */
+    static constexpr size_t WRITE_BATCH = 256;
+
+    /**
+     * \brief Atende o pedido mais antigo da fila da conexão (ou a sequência de escritas iguais que
+     *        começa nele, em um lote) e reagenda se restarem outros.
+     * \pre Chamado a partir de uma tarefa do pool, com `c->busy` verdadeiro e fila não vazia.
+     * \post Respostas acrescentadas a `c->out` depois da publicação; `c->busy` volta a falso quando
+     *       a fila esvazia.
+     */
+    void serve(const shared_ptr<Connection>& c);
+
+    /**
+     * \brief Executa uma requisição.
+     * \pre Chamado a partir de uma tarefa do pool.
+     * \post Quadro de resposta acrescentado ao final de `reply`.
+     */
+    void handle(const Request& r, vector<uint8_t>& reply);
+
+    /**
+     * \brief Envia o que for possível do buffer de saída sem bloquear.
+     * \pre Descritor em modo não bloqueante.
+     * \post Retorna falso se a conexão falhou.
+     */
+    bool flush(Connection& c);
+
+    /** \brief Tempo máximo, em ms, para entregar as respostas pendentes no encerramento. */
+    static constexpr int DRAIN_MS = 2000;
+
+    /**
+     * \brief Entrega as respostas pendentes de todas as conexões antes do encerramento.
+     * \pre Pool ocioso (nenhuma resposta nova será enfileirada).
+     * \post Buffers de saída vazios, salvo conexões com falha ou esgotado `DRAIN_MS`.
+     */
+    void drain();
+
+public:
+    /**
+     * \brief Prepara o servidor para o grafo e caminho de socket informados.
+     * \pre `g` deve permanecer válido durante `run`; `threads == 0` usa todos os núcleos.
+     * \post Nenhum recurso de rede alocado até `run`.
+     */
+    QueryServer(Graph& g, const string& path, unsigned threads = 0);
+
+    /**
+     * \brief Fecha socket e remove o arquivo do socket.
+     * \pre Nenhuma.
+     * \post Recursos liberados.
+     */
+    ~QueryServer();
+
+    QueryServer(const QueryServer&) = delete;
+    QueryServer& operator=(const QueryServer&) = delete;
+
+    /**
+     * \brief Executa o laço de atendimento até `SHUTDOWN` ou `stop`.
+     * \pre Caminho do socket gravável.
+     * \post Retorna falso se não foi possível abrir o socket.
+     */
+    bool run();
+
+    /**
+     * \brief Solicita a parada do servidor (seguro em tratador de sinal).
+     * \pre Nenhuma.
+     * \post `run` retorna após concluir as requisições em andamento.
+     */
+    void stop();
+
+    /**
+     * \brief Número de requisições atendidas.
+     * \pre Nenhuma.
+     * \post Contador monotônico.
+     */
+    uint64_t requestsServed() const { return served.load(); }
+};
+
+#endif
@@ -0,0 +1,161 @@
+/**
+* @file QueryServerCheck.cpp
+* @authors
+*   Francisco Eduardo Fontenele - 15452569
+*   Vinicius Botte - 15522900
+*
+* \brief Verificação de ordem por conexão do `QueryServer` (executável `KruskalsMSTServerCheck`).
+*
+* \details Sobe um servidor com várias threads em um grafo vazio e, em uma única conexão, envia em
+*          pipeline `N` trincas `INSERT_VERTEX k`, `HAS_VERTEX k`, `DELETE_VERTEX k`. Cada
+*          `HAS_VERTEX` deve ver a inserção anterior (status OK) e as respostas devem chegar na ordem
+*          dos ids. Depois envia sequências de escritas iguais (vértices `c<i>`, um caminho de
+*          `INSERT_EDGE` entre eles, buscas `HAS_EDGE` e remoções), que o servidor agrupa em lotes,
+*          e exige que cada busca veja o caminho. Por fim insere uma chave com mais de 64 KiB e
+*          confere que `VERTICES` a devolve inteira. Encerra o servidor com `SHUTDOWN`.
+*
+* \pre Sistema POSIX; diretório de trabalho gravável.
+* \post Código de saída 0 se todas as verificações passarem, 1 caso contrário.
+*/
+
+#include "Graph.h"
+#include "QueryProtocol.h"
+#include "QueryServer.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+using namespace std;
+
+/**
+ * \brief Conecta ao socket do servidor, aguardando-o subir por até alguns segundos.
+ * \pre Caminho válido.
+ * \post Retorna descritor ou -1 se o servidor não respondeu.
+ */
+static int connectTo(const string& path) {
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(addr.sun_path)) return -1;
+    memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+    for (int attempt = 0; attempt < 500; ++attempt) {
+        int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0) return -1;
+        if (connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof addr) == 0) return fd;
+        close(fd);
+        this_thread::sleep_for(chrono::milliseconds(10));
+    }
+    return -1;
+}
+
+static bool sendAll(int fd, const vector<uint8_t>& buf) {
+    size_t sent = 0;
+    while (sent < buf.size()) {
+        ssize_t n = send(fd, buf.data() + sent, buf.size() - sent, 0);
+        if (n <= 0) return false;
+        sent += static_cast<size_t>(n);
+    }
+    return true;
+}
+
+/**
+ * \brief Ponto de entrada da verificação.
+ * \pre Argumentos opcionais: `[trincas] [threads]` (padrão 2000 e 8).
+ * \post Imprime as contagens e retorna 1 se alguma verificação falhar.
+ */
+int main(int argc, char* argv[]) {
+    int triples = argc >= 2 ? max(1, atoi(argv[1])) : 2000;
+    unsigned threads = argc >= 3 ? static_cast<unsigned>(max(1, atoi(argv[2]))) : 8u;
+    const string graphPath = "query_server_check.bin";
+    const string socketPath = "query_server_check.sock";
+    remove(graphPath.c_str());
+
+    int failures = 0;
+    {
+        Graph graph(graphPath);
+        QueryServer server(graph, socketPath, threads);
+        thread serving([&] { if (!server.run()) server.stop(); });
+
+        int fd = connectTo(socketPath);
+        if (fd < 0) {
+            cout << "Servidor indisponivel: " << socketPath << "\n";
+            server.stop();
+            serving.join();
+            remove(graphPath.c_str());
+            return 1;
+        }
+
+        vector<uint8_t> batch;
+        uint32_t total = 0;
+        auto request = [&](QueryOp op, const vector<string>& keys) {
+            FrameWriter w(batch, total++, static_cast<uint8_t>(op));
+            for (const auto& k : keys) w.str(k);
+            if (op == QueryOp::INSERT_EDGE) w.i32(1);
+            w.finish();
+        };
+        for (int i = 0; i < triples; ++i) {
+            string k = "k" + to_string(i);
+            request(QueryOp::INSERT_VERTEX, {k});
+            request(QueryOp::HAS_VERTEX, {k});
+            request(QueryOp::DELETE_VERTEX, {k});
+        }
+        // Sequências maiores que um lote do servidor (`WRITE_BATCH`).
+        const int chain = 300;
+        for (int i = 0; i < chain; ++i) request(QueryOp::INSERT_VERTEX, {"c" + to_string(i)});
+        for (int i = 0; i + 1 < chain; ++i) request(QueryOp::INSERT_EDGE, {"c" + to_string(i), "c" + to_string(i + 1)});
+        for (int i = 0; i + 1 < chain; ++i) request(QueryOp::HAS_EDGE, {"c" + to_string(i + 1), "c" + to_string(i)});
+        for (int i = 0; i < chain; ++i) request(QueryOp::DELETE_VERTEX, {"c" + to_string(i)});
+        // Chave maior que 64 KiB: o comprimento das strings no protocolo não pode ser truncado.
+        const string longKey(70000, 'x');
+        request(QueryOp::INSERT_VERTEX, {longKey});
+        uint32_t verticesId = total;
+        request(QueryOp::VERTICES, {});
+        request(QueryOp::DELETE_VERTEX, {longKey});
+        request(QueryOp::SHUTDOWN, {});
+        // Envio em outra thread: o cliente lê as respostas enquanto o pipeline ainda está sendo escrito.
+        thread sender([&] { sendAll(fd, batch); });
+
+        int notFound = 0, outOfOrder = 0, badKeys = 0;
+        uint32_t expected = 0;
+        vector<uint8_t> pending;
+        uint8_t buf[64 * 1024];
+        while (expected < total) {
+            ssize_t n = recv(fd, buf, sizeof buf, 0);
+            if (n <= 0) break;
+            pending.insert(pending.end(), buf, buf + n);
+            size_t pos = 0;
+            while (pending.size() - pos >= sizeof(uint32_t) + QUERY_HEADER) {
+                uint32_t len = 0, id = 0;
+                memcpy(&len, &pending[pos], sizeof len);
+                if (pending.size() - pos < sizeof(uint32_t) + len) break;
+                memcpy(&id, &pending[pos + 4], sizeof id);
+                uint8_t status = pending[pos + 8];
+                if (id != expected) ++outOfOrder;
+                if (status != static_cast<uint8_t>(QueryStatus::OK)) ++notFound;
+                if (id == verticesId) {
+                    FrameReader r(&pending[pos + 9], len - QUERY_HEADER);
+                    if (r.u32() != 1 || r.str() != longKey || !r.ok()) ++badKeys;
+                }
+                ++expected;
+                pos += sizeof(uint32_t) + len;
+            }
+            pending.erase(pending.begin(), pending.begin() + static_cast<ptrdiff_t>(pos));
+        }
+        sender.join();
+        close(fd);
+        serving.join();
+
+        cout << "Respostas: " << expected << " de " << total << ", fora de ordem: " << outOfOrder
+             << ", sem sucesso: " << notFound << ", chave longa incorreta: " << badKeys << "\n";
+        if (expected != total || outOfOrder != 0 || notFound != 0 || badKeys != 0) ++failures;
+        if (graph.getAllVertices().size() != 0) ++failures;
+    }
+    remove(graphPath.c_str());
+    cout << "Falhas: " << failures << "\n";
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,57 @@
+/**
+* @file SecondBestMST.cpp
+* @authors
+*   Francisco Eduardo Fontenele - 15452569
+*   Vinicius Botte - 15522900
+*
+* \brief Implementação da segunda melhor árvore geradora.
+*
+* \details Para cada aresta fora da MST, o acréscimo é seu custo menos o gargalo do seu caminho na
+*          árvore; escolhe-se o menor acréscimo.
+*
+* \pre O grafo deve estar carregado.
+* \post Resultado com a troca e o novo custo total.
+*/
+
+#include "SecondBestMST.h"
+#include "MstPathIndex.h"
+#include <limits>
+using namespace std;
+
+bool SecondBestMST::compute(const Graph& g, const vector<Edge>& mst, int mstCost, SecondBestResult& out) {
+    out = SecondBestResult();
+
+    auto snap = g.snapshot();
+    MstPathIndex index(snap->getAllVertices(), mst);
+    const vector<Edge>& forest = index.forestEdges();
+
+    int bestDelta = numeric_limits<int>::max();
+    int bestRemoved = -1;
+    bool found = false;
+    for (const auto& e : snap->getEdgesUnique()) {
+        int u = index.indexOf(e.u());
+        int v = index.indexOf(e.v());
+        if (index.forestEdgeIndex(u, v) >= 0) continue;
+        int m = index.maxEdgeIndex(u, v);
+        if (m < 0) continue;
+        int delta = e.weight() - forest[m].weight();
+        if (delta < bestDelta) {
+            bestDelta = delta;
+            bestRemoved = m;
+            out.added = e;
+            found = true;
+            if (delta == 0) break;
+        }
+    }
+    if (!found) return false;
+
+    out.removed = forest[bestRemoved];
+    out.delta = bestDelta;
+    out.totalCost = mstCost + bestDelta;
+    out.tree.reserve(forest.size());
+    for (size_t i = 0; i < forest.size(); ++i) {
+        if (static_cast<int>(i) != bestRemoved) out.tree.push_back(forest[i]);
+    }
+    out.tree.push_back(out.added);
+    return true;
+}
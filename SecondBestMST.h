@@ -0,0 +1,47 @@
+/**
+* @file SecondBestMST.h
+* @authors
+*   Francisco Eduardo Fontenele - 15452569
+*   Vinicius Botte - 15522900
+*
+* \brief Calcula a segunda melhor árvore geradora (projeto reserva do backbone).
+*
+* \details A segunda melhor árvore difere da MST por uma única troca: entra uma aresta fora da MST e
+*          sai a aresta de maior custo do ciclo formado. Reaproveita a MST já calculada e o índice de
+*          gargalo (`MstPathIndex`), em O(E log V).
+*
+* \pre A MST fornecida deve ter sido calculada sobre o mesmo grafo.
+* \post Retorna a troca de menor acréscimo de custo, se existir.
+*/
+
+#ifndef SECOND_BEST_MST_H
+#define SECOND_BEST_MST_H
+
+#include <vector>
+#include "Graph.h"
+#include "Edge.h"
+using namespace std;
+
+/**
+ * \brief Resultado da segunda melhor árvore.
+ * \details `tree` é a MST com `removed` trocada por `added`; `delta` é o acréscimo sobre o custo da MST.
+ */
+struct SecondBestResult {
+    vector<Edge> tree;
+    int totalCost = 0;
+    int delta = 0;
+    Edge removed{"", "", 0};
+    Edge added{"", "", 0};
+};
+
+class SecondBestMST {
+public:
+    /**
+     * \brief Encontra a segunda melhor árvore geradora a partir da MST.
+     * \pre `mst` e `mstCost` devem vir de `KruskalMST::compute(g, ...)`.
+     * \post Retorna falso se não houver aresta fora da MST (árvore única); caso contrário preenche `out`.
+     */
+    static bool compute(const Graph& g, const vector<Edge>& mst, int mstCost, SecondBestResult& out);
+};
+
+#endif
@@ -8,13 +8,16 @@
 * \brief Implementação da exportação simples para arquivos texto.
 *
 * \details Serializa vértices e arestas únicas do grafo, e MST, em formatos fáceis
-*          de consumir por Python sem dependências de Graphviz.
+*          de consumir por Python sem dependências de Graphviz. Os `.npy` seguem o formato 1.0
+*          do NumPy (cabeçalho com dicionário alinhado em 64 bytes e dados contíguos).
 *
 * \pre Arquivos de saída devem ser graváveis.
 * \post Arquivos `graph_vertices.txt`, `graph_edges.txt` e `mst_edges.txt` gerados conforme chamado.
 */
 #include "SimpleExporter.h"
 #include <fstream>
+#include <cstdint>
+#include <cstring>
 using namespace std;
 
 static bool writeLines(const string& path, const vector<string>& lines) {
@@ -24,15 +27,102 @@ static bool writeLines(const string& path, const vector<string>& lines) {
     return true;
 }
 
+/**
+ * \brief Grava um array NumPy 2D de inteiros (C order) a partir de um bloco contíguo.
+ * \pre `data` tem `rows * cols` elementos.
+ * \post Retorna falso se o arquivo não pôde ser gravado.
+ */
+template <typename T>
+static bool writeNpy(const string& path, const vector<T>& data, size_t rows, size_t cols) {
+    ofstream out(path, ios::binary | ios::trunc);
+    if (!out) return false;
+    const uint16_t probe = 1;
+    char order = 0;
+    memcpy(&order, &probe, 1);
+    string header = string("{'descr': '") + (order ? '<' : '>') + "i" + to_string(sizeof(T)) +
+                    "', 'fortran_order': False, 'shape': (" + to_string(rows) + ", " + to_string(cols) + "), }";
+    // Magic (6) + versão (2) + tamanho (2) + cabeçalho terminado em '\n', múltiplo de 64.
+    size_t total = 10 + header.size() + 1;
+    header.append((64 - total % 64) % 64, ' ');
+    header.push_back('\n');
+    uint16_t len = static_cast<uint16_t>(header.size());
+    out.write("\x93NUMPY\x01\x00", 8);
+    const unsigned char lenBytes[2] = {static_cast<unsigned char>(len & 0xFF), static_cast<unsigned char>(len >> 8)};
+    out.write(reinterpret_cast<const char*>(lenBytes), 2);
+    out.write(header.data(), static_cast<streamsize>(header.size()));
+    out.write(reinterpret_cast<const char*>(data.data()), static_cast<streamsize>(data.size() * sizeof(T)));
+    return static_cast<bool>(out);
+}
+
+/**
+ * \brief Preenche as três linhas (u, v, custo) das arestas únicas do snapshot e grava o `.npy`.
+ * \pre Nenhuma.
+ * \post Mesma ordem de `getEdgesUnique`.
+ */
+template <typename T>
+static bool writeEdgesNpy(const GraphSnapshot& snap, const string& path) {
+    const auto& ids = snap.neighborIds();
+    const auto& costs = snap.neighborCosts();
+    size_t m = 0;
+    for (int u = 0; u < snap.vertexCount(); ++u) {
+        for (int i = snap.begin(u); i < snap.end(u); ++i) m += u < ids[i];
+    }
+    vector<T> data(3 * m);
+    size_t k = 0;
+    for (int u = 0; u < snap.vertexCount(); ++u) {
+        for (int i = snap.begin(u); i < snap.end(u); ++i) {
+            if (u >= ids[i]) continue;
+            data[k] = u;
+            data[m + k] = ids[i];
+            data[2 * m + k] = costs[i];
+            ++k;
+        }
+    }
+    return writeNpy(path, data, 3, m);
+}
+
+/**
+ * \brief Converte as arestas da MST para ids do snapshot e grava o `.npy`.
+ * \pre Nenhuma.
+ * \post Arestas com chaves desconhecidas são omitidas.
+ */
+template <typename T>
+static bool writeMstNpy(const GraphSnapshot& snap, const vector<Edge>& mst, const string& path) {
+    vector<T> u, v, w;
+    u.reserve(mst.size());
+    v.reserve(mst.size());
+    w.reserve(mst.size());
+    for (const auto& e : mst) {
+        int a = snap.indexOf(e.u());
+        int b = snap.indexOf(e.v());
+        if (a < 0 || b < 0) continue;
+        u.push_back(a);
+        v.push_back(b);
+        w.push_back(e.weight());
+    }
+    size_t k = u.size();
+    u.insert(u.end(), v.begin(), v.end());
+    u.insert(u.end(), w.begin(), w.end());
+    return writeNpy(path, u, 3, k);
+}
+
 bool SimpleExporter::exportVertices(const Graph& g, const string& verticesPath) {
-    vector<string> vs = g.getAllVertices();
-    return writeLines(verticesPath, vs);
+    return exportVertices(*g.snapshot(), verticesPath);
 }
 
 bool SimpleExporter::exportEdges(const Graph& g, const string& edgesPath) {
+    return exportEdges(*g.snapshot(), edgesPath);
+}
+
+bool SimpleExporter::exportVertices(const GraphSnapshot& snap, const string& verticesPath) {
+    vector<string> vs = snap.getAllVertices();
+    return writeLines(verticesPath, vs);
+}
+
+bool SimpleExporter::exportEdges(const GraphSnapshot& snap, const string& edgesPath) {
     ofstream out(edgesPath);
     if (!out) return false;
-    for (const auto& e : g.getEdgesUnique()) {
+    for (const auto& e : snap.getEdgesUnique()) {
         out << e.u() << " " << e.v() << " " << e.weight() << "\n";
     }
     return true;
@@ -46,3 +136,25 @@ bool SimpleExporter::exportMst(const vector<Edge>& mst, const string& mstPath) {
     }
     return true;
 }
+
+bool SimpleExporter::exportEdgesNpy(const GraphSnapshot& snap, const string& path, bool wide) {
+    return wide ? writeEdgesNpy<int64_t>(snap, path) : writeEdgesNpy<int32_t>(snap, path);
+}
+
+bool SimpleExporter::exportMstNpy(const GraphSnapshot& snap, const vector<Edge>& mst, const string& path, bool wide) {
+    return wide ? writeMstNpy<int64_t>(snap, mst, path) : writeMstNpy<int32_t>(snap, mst, path);
+}
+
+bool SimpleExporter::exportSensitivity(const vector<EdgeSensitivity>& report, const string& path) {
+    ofstream out(path);
+    if (!out) return false;
+    for (const auto& s : report) {
+        out << s.edge.u() << " " << s.edge.v() << " " << s.edge.weight() << " " << (s.inMst ? "T" : "N");
+        if (s.hasPartner) {
+            out << " " << s.partner.u() << " " << s.partner.v() << " " << s.partner.weight() << " " << s.threshold << "\n";
+        } else {
+            out << " - - - -\n";
+        }
+    }
+    return true;
+}
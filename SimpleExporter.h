@@ -9,6 +9,8 @@
 *
 * \details Gera dois arquivos: `graph_vertices.txt` (um vértice por linha)
 *          e `graph_edges.txt` (linhas "u v w"). Opcionalmente grava `mst_edges.txt`.
+*          No modo binário, grava `graph_edges.npy` e `mst_edges.npy` (NumPy, forma (3, E):
+*          linhas u, v e custo, em int32 ou int64) com ids que indexam `graph_vertices.txt`.
 *
 * \pre Caminhos devem ser graváveis; o grafo deve estar carregado.
 * \post Arquivos texto gerados para consumo por script Python.
@@ -20,6 +22,7 @@
 #include <vector>
 #include "Graph.h"
 #include "Edge.h"
+#include "MstSensitivity.h"
 using namespace std;
 
 class SimpleExporter {
@@ -34,9 +37,38 @@ public:
      */
     static bool exportEdges(const Graph& g, const string& edgesPath);
 
+    /**
+     * \brief Exporta vértices de uma versão imutável do grafo.
+     * \details A linha i contém a chave do id i: o arquivo é a tabela de chaves dos `.npy`.
+     */
+    static bool exportVertices(const GraphSnapshot& snap, const string& verticesPath);
+
+    /**
+     * \brief Exporta arestas únicas de uma versão imutável do grafo.
+     */
+    static bool exportEdges(const GraphSnapshot& snap, const string& edgesPath);
+
     /**
      * \brief Exporta arestas da MST para arquivo texto ("u v w" por linha).
      */
     static bool exportMst(const vector<Edge>& mst, const string& mstPath);
+
+    /**
+     * \brief Exporta arestas únicas como `.npy` de forma (3, E): ids u, ids v e custos.
+     * \details Grava o bloco de inteiros de uma vez, sem formatação de texto; `wide` escolhe int64.
+     */
+    static bool exportEdgesNpy(const GraphSnapshot& snap, const string& path, bool wide = false);
+
+    /**
+     * \brief Exporta a MST como `.npy` de forma (3, E), com ids do snapshot `snap`.
+     * \details Arestas com chaves fora do snapshot são omitidas.
+     */
+    static bool exportMstNpy(const GraphSnapshot& snap, const vector<Edge>& mst, const string& path, bool wide = false);
+
+    /**
+     * \brief Exporta a análise de sensibilidade ("u v w tipo pu pv pw limite" por linha).
+     * \details `tipo` é `T` (aresta da MST) ou `N` (fora da MST); sem parceira, `pu pv pw limite` são `-`.
+     */
+    static bool exportSensitivity(const vector<EdgeSensitivity>& report, const string& path);
 };
 #endif
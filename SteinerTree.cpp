@@ -0,0 +1,157 @@
+/**
+* @file SteinerTree.cpp
+* @authors
+*   Francisco Eduardo Fontenele - 15452569
+*   Vinicius Botte - 15522900
+*
+* \brief Implementação da árvore de Steiner aproximada (Mehlhorn).
+*
+* \details O Dijkstra guarda, por vértice, a distância e o terminal mais próximo e o predecessor.
+*          Para cada par de regiões vizinhas fica só a aresta de ligação mais barata, então o fecho
+*          tem no máximo E arestas. A expansão segue os predecessores até o terminal de cada lado.
+*          Distâncias e pesos do fecho são somas de custos, então usam `int64_t`; só são estreitados
+*          para `int` depois de conferidos contra `INT_MAX`.
+*
+* \pre Nenhuma.
+* \post Nenhuma.
+*/
+
+#include "SteinerTree.h"
+#include "KruskalMST.h"
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+using namespace std;
+
+bool SteinerTree::compute(const Graph& g, const vector<string>& terminals, SteinerResult& out) {
+    return compute(*g.snapshot(), terminals, out);
+}
+
+bool SteinerTree::compute(const GraphSnapshot& snap, const vector<string>& terminals, SteinerResult& out) {
+    out = SteinerResult();
+
+    const int n = snap.vertexCount();
+    const auto& ids = snap.neighborIds();
+    const auto& costs = snap.neighborCosts();
+    vector<int64_t> dist(n, numeric_limits<int64_t>::max());
+    vector<int> source(n, -1);
+    vector<int> pred(n, -1);
+    vector<string> keys;
+
+    // Terminais: cada um é a origem da própria região.
+    using Item = pair<int64_t, int>;
+    priority_queue<Item, vector<Item>, greater<Item>> heap;
+    for (const auto& key : terminals) {
+        int id = snap.indexOf(key);
+        if (id < 0) {
+            out.missing.push_back(key);
+            continue;
+        }
+        if (source[id] >= 0) continue;
+        source[id] = static_cast<int>(keys.size());
+        dist[id] = 0;
+        keys.push_back(key);
+        heap.push({0, id});
+    }
+    if (!out.missing.empty()) return false;
+    out.terminals = static_cast<int>(keys.size());
+    out.components = out.terminals;
+    if (out.terminals < 2) return true;
+
+    // Dijkstra com várias origens: regiões de Voronoi.
+    while (!heap.empty()) {
+        auto [d, u] = heap.top();
+        heap.pop();
+        if (d > dist[u]) continue;
+        for (int i = snap.begin(u); i < snap.end(u); ++i) {
+            int v = ids[i];
+            if (d + costs[i] < dist[v]) {
+                dist[v] = d + costs[i];
+                source[v] = source[u];
+                pred[v] = u;
+                heap.push({dist[v], v});
+            }
+        }
+    }
+
+    // Fecho de Voronoi: a ligação mais barata entre cada par de regiões vizinhas.
+    struct Bridge { int a; int b; int64_t w; int u; int v; };
+    vector<Bridge> bridges;
+    for (int u = 0; u < n; ++u) {
+        if (source[u] < 0) continue;
+        for (int i = snap.begin(u); i < snap.end(u); ++i) {
+            int v = ids[i];
+            if (u > v || source[u] == source[v]) continue;
+            int a = min(source[u], source[v]);
+            int b = max(source[u], source[v]);
+            bridges.push_back({a, b, dist[u] + costs[i] + dist[v], u, v});
+        }
+    }
+    sort(bridges.begin(), bridges.end(), [](const Bridge& x, const Bridge& y) {
+        if (x.a != y.a) return x.a < y.a;
+        if (x.b != y.b) return x.b < y.b;
+        return x.w < y.w;
+    });
+    bridges.erase(unique(bridges.begin(), bridges.end(),
+                         [](const Bridge& x, const Bridge& y) { return x.a == y.a && x.b == y.b; }),
+                  bridges.end());
+    out.closureEdges = bridges.size();
+
+    // O fecho já está numerado pelos terminais (`a < b`), então o Kruskal roda direto sobre ids.
+    vector<IdEdge> closure;
+    closure.reserve(bridges.size());
+    for (const auto& br : bridges) {
+        if (br.w > INT_MAX) {
+            out.overflow = true;
+            return false;
+        }
+        closure.push_back({static_cast<int>(br.w), br.a, br.b});
+    }
+    vector<IdEdge> closureMst;
+    KruskalMST kruskal;
+    kruskal.computeForest(out.terminals, closure, closureMst);
+    out.components = out.terminals - static_cast<int>(closureMst.size());
+    int64_t closureCost = 0;
+    for (const auto& e : closureMst) closureCost += e.w;
+
+    // Expansão: ligação real mais os caminhos mínimos até o terminal de cada lado. Cada região
+    // contribui com uma subárvore da árvore de caminhos mínimos e as ligações formam uma árvore
+    // entre regiões, então o resultado já é uma árvore cujas folhas são terminais.
+    // Cada aresta da expansão é uma aresta real do grafo, então seu custo cabe em `int`.
+    vector<char> used(n, 0);
+    int64_t totalCost = 0;
+    auto climb = [&](int v) {
+        while (pred[v] >= 0 && !used[v]) {
+            used[v] = 1;
+            int w = static_cast<int>(dist[v] - dist[pred[v]]);
+            out.tree.push_back(snap.makeEdge(pred[v], v, w));
+            totalCost += w;
+            v = pred[v];
+        }
+    };
+    for (const auto& e : closureMst) {
+        int a = e.u;
+        int b = e.v;
+        auto it = lower_bound(bridges.begin(), bridges.end(), make_pair(a, b),
+                              [](const Bridge& x, const pair<int, int>& key) {
+                                  return x.a != key.first ? x.a < key.first : x.b < key.second;
+                              });
+        int w = static_cast<int>(it->w - dist[it->u] - dist[it->v]);
+        out.tree.push_back(snap.makeEdge(it->u, it->v, w));
+        totalCost += w;
+        climb(it->u);
+        climb(it->v);
+    }
+    if (totalCost > INT_MAX || closureCost > INT_MAX) {
+        out.tree.clear();
+        out.overflow = true;
+        return false;
+    }
+    out.totalCost = static_cast<int>(totalCost);
+    out.closureCost = static_cast<int>(closureCost);
+    return true;
+}
@@ -0,0 +1,67 @@
+/**
+* @file SteinerTree.h
+* @authors
+*   Francisco Eduardo Fontenele - 15452569
+*   Vinicius Botte - 15522900
+*
+* \brief Árvore de Steiner aproximada para um subconjunto de vértices terminais.
+*
+* \details Conecta apenas os terminais (ex.: PoPs), usando os demais vértices como trânsito.
+*          Algoritmo de Mehlhorn: um Dijkstra a partir de todos os terminais divide o grafo em
+*          regiões de Voronoi; cada aresta entre regiões vira uma aresta do fecho métrico entre os
+*          dois terminais, e a MST desse fecho (Kruskal) é expandida nos caminhos mínimos reais.
+*          Custo no máximo 2(1 - 1/t) vezes o ótimo, em O(E log V), sem o fecho completo t x t.
+*
+* \pre O grafo não deve ter custos negativos.
+* \post Resultado com as arestas reais da árvore (uma floresta se os terminais estiverem em
+*       componentes diferentes).
+*/
+
+#ifndef STEINER_TREE_H
+#define STEINER_TREE_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "Graph.h"
+#include "Edge.h"
+using namespace std;
+
+/**
+ * \brief Resultado da árvore de Steiner.
+ * \details `closureCost` é o custo da MST do fecho de Voronoi (limite superior de `totalCost`:
+ *          caminhos compartilhados são contados uma só vez na árvore real). `components` é o
+ *          número de grupos de terminais que não se alcançam. `missing` lista as chaves
+ *          desconhecidas; nesse caso nada é calculado. `overflow` indica que uma distância do fecho
+ *          ou um custo total excedeu `INT_MAX`; nesse caso também não há árvore.
+ */
+struct SteinerResult {
+    vector<Edge> tree;
+    int totalCost = 0;
+    int closureCost = 0;
+    int terminals = 0;
+    int components = 0;
+    size_t closureEdges = 0;
+    vector<string> missing;
+    bool overflow = false;
+};
+
+class SteinerTree {
+public:
+    /**
+     * \brief Calcula a árvore de Steiner aproximada sobre o snapshot corrente do grafo.
+     * \pre Chaves repetidas em `terminals` são ignoradas.
+     * \post Retorna falso se alguma chave não existir no grafo ou se um custo não couber em `int`
+     *       (`out.overflow`).
+     */
+    static bool compute(const Graph& g, const vector<string>& terminals, SteinerResult& out);
+
+    /**
+     * \brief Calcula a árvore de Steiner aproximada sobre uma versão imutável do grafo.
+     * \pre Igual à versão com `Graph`.
+     * \post Igual à versão com `Graph`, sobre `snap`.
+     */
+    static bool compute(const GraphSnapshot& snap, const vector<string>& terminals, SteinerResult& out);
+};
+
+#endif
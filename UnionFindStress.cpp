@@ -0,0 +1,160 @@
+/**
+* @file UnionFindStress.cpp
+* @authors
+*   Francisco Eduardo Fontenele - 15452569
+*   Vinicius Botte - 15522900
+*
+* \brief Teste de estresse do `ConcurrentUnionFind` (executável `KruskalsMSTStress`).
+*
+* \details Separado da CLI: só depende do Union-Find concorrente e é registrado no CTest com uma
+*          carga pequena; execuções maiores recebem threads, elementos e operações por argumento.
+*
+* \pre Nenhuma.
+* \post Código de saída 0 sem violações, 1 caso contrário.
+*/
+
+#include "ConcurrentUnionFind.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <vector>
+using namespace std;
+
+/**
+ * \brief Raiz em um Union-Find sequencial (referência do teste de estresse).
+ * \pre `x` válido.
+ * \post Caminho comprimido por halving.
+ */
+static int sequentialFind(vector<int>& parent, int x) {
+    while (parent[x] != x) {
+        parent[x] = parent[parent[x]];
+        x = parent[x];
+    }
+    return x;
+}
+
+/**
+ * \brief Estresse do `ConcurrentUnionFind` com verificação de linearizabilidade.
+ * \pre `threads >= 1`, `elements >= 2`, `opsPerThread >= 1`.
+ * \post Threads misturam `unite` e `sameSet` aleatórios; cada operação recebe carimbos de início e
+ *       fim de um relógio global. Depois, com Union-Find sequencial, verifica que toda resposta
+ *       positiva é explicada pelas uniões iniciadas antes do seu fim, que toda resposta negativa é
+ *       compatível com as uniões concluídas antes do seu início, que o número de uniões efetivas é
+ *       `elements - componentes` e que a partição final é a sequencial. Retorna 1 se houver violação.
+ */
+static int runUnionFindStress(int threads, int elements, int opsPerThread) {
+    struct Op { uint64_t start, end; int a, b; bool unite, result; };
+    ConcurrentUnionFind sets(elements);
+    atomic<uint64_t> clock{0};
+    vector<vector<Op>> logs(static_cast<size_t>(threads));
+
+    auto t0 = chrono::steady_clock::now();
+    {
+        vector<thread> workers;
+        for (int t = 0; t < threads; ++t) {
+            workers.emplace_back([&, t] {
+                mt19937 rng(static_cast<unsigned>(t) * 7919u + 1u);
+                uniform_int_distribution<int> pick(0, elements - 1);
+                auto& log = logs[static_cast<size_t>(t)];
+                log.reserve(static_cast<size_t>(opsPerThread));
+                for (int i = 0; i < opsPerThread; ++i) {
+                    Op op{0, 0, pick(rng), pick(rng), rng() % 4 == 0, false};
+                    op.start = clock.fetch_add(1);
+                    op.result = op.unite ? sets.unite(op.a, op.b) : sets.sameSet(op.a, op.b);
+                    op.end = clock.fetch_add(1);
+                    log.push_back(op);
+                }
+            });
+        }
+        for (auto& w : workers) w.join();
+    }
+    double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+
+    vector<Op> ops;
+    for (auto& log : logs) ops.insert(ops.end(), log.begin(), log.end());
+    vector<const Op*> unites;
+    size_t merges = 0;
+    for (const auto& op : ops) {
+        if (!op.unite) continue;
+        unites.push_back(&op);
+        if (op.result) ++merges;
+    }
+
+    size_t violations = 0;
+    // Respostas positivas (sameSet verdadeiro, unite falso): uniões iniciadas antes do fim bastam.
+    {
+        vector<const Op*> positive;
+        for (const auto& op : ops) if (op.result != op.unite) positive.push_back(&op);
+        sort(positive.begin(), positive.end(), [](const Op* x, const Op* y) { return x->end < y->end; });
+        vector<const Op*> byStart = unites;
+        sort(byStart.begin(), byStart.end(), [](const Op* x, const Op* y) { return x->start < y->start; });
+        vector<int> parent(static_cast<size_t>(elements));
+        iota(parent.begin(), parent.end(), 0);
+        size_t next = 0;
+        for (const Op* q : positive) {
+            while (next < byStart.size() && byStart[next]->start < q->end) {
+                if (byStart[next] != q) parent[sequentialFind(parent, byStart[next]->a)] = sequentialFind(parent, byStart[next]->b);
+                ++next;
+            }
+            if (sequentialFind(parent, q->a) != sequentialFind(parent, q->b)) ++violations;
+        }
+    }
+    // Respostas negativas (sameSet falso, unite verdadeiro): uniões concluídas antes do início não podem ligar.
+    {
+        vector<const Op*> negative;
+        for (const auto& op : ops) if (op.result == op.unite) negative.push_back(&op);
+        sort(negative.begin(), negative.end(), [](const Op* x, const Op* y) { return x->start < y->start; });
+        vector<const Op*> byEnd = unites;
+        sort(byEnd.begin(), byEnd.end(), [](const Op* x, const Op* y) { return x->end < y->end; });
+        vector<int> parent(static_cast<size_t>(elements));
+        iota(parent.begin(), parent.end(), 0);
+        size_t next = 0;
+        for (const Op* q : negative) {
+            while (next < byEnd.size() && byEnd[next]->end < q->start) {
+                parent[sequentialFind(parent, byEnd[next]->a)] = sequentialFind(parent, byEnd[next]->b);
+                ++next;
+            }
+            if (sequentialFind(parent, q->a) == sequentialFind(parent, q->b)) ++violations;
+        }
+    }
+    // Estado final: mesma partição do Union-Find sequencial com todas as uniões.
+    vector<int> parent(static_cast<size_t>(elements));
+    iota(parent.begin(), parent.end(), 0);
+    for (const Op* u : unites) parent[sequentialFind(parent, u->a)] = sequentialFind(parent, u->b);
+    vector<int> seqToConc(static_cast<size_t>(elements), -1), concToSeq(static_cast<size_t>(elements), -1);
+    int seqComponents = 0;
+    for (int x = 0; x < elements; ++x) {
+        int r = sequentialFind(parent, x);
+        int c = sets.find(x);
+        if (r == x) ++seqComponents;
+        if (seqToConc[r] < 0) seqToConc[r] = c;
+        if (concToSeq[c] < 0) concToSeq[c] = r;
+        if (seqToConc[r] != c || concToSeq[c] != r) ++violations;
+    }
+    if (merges != static_cast<size_t>(elements - seqComponents) || sets.componentCount() != seqComponents) ++violations;
+
+    double total = static_cast<double>(ops.size());
+    cout << "Threads: " << threads << ", elementos: " << elements << ", operacoes: " << ops.size()
+         << " (" << unites.size() << " unioes, " << merges << " efetivas)\n";
+    cout << "Tempo: " << ms << " ms (" << (ms > 0 ? total / ms / 1000.0 : 0.0) << " Mops/s)\n";
+    cout << "Componentes: " << seqComponents << ", violacoes: " << violations << "\n";
+    return violations == 0 ? 0 : 1;
+}
+
+/**
+ * \brief Ponto de entrada do teste de estresse.
+ * \pre Argumentos opcionais: `[threads] [elementos] [operacoes_por_thread]`.
+ * \post Retorna o código de `runUnionFindStress`.
+ */
+int main(int argc, char* argv[]) {
+    int threads = argc >= 2 ? max(1, atoi(argv[1])) : max(1, static_cast<int>(thread::hardware_concurrency()));
+    int elements = argc >= 3 ? max(2, atoi(argv[2])) : 100000;
+    int ops = argc >= 4 ? max(1, atoi(argv[3])) : 200000;
+    return runUnionFindStress(threads, elements, ops);
+}
@@ -0,0 +1,119 @@
+/**
+* @file VertexOrdering.cpp
+* @authors
+*   Francisco Eduardo Fontenele - 15452569
+*   Vinicius Botte - 15522900
+*
+* \brief Implementação das ordens BFS, RCM e por grau.
+*
+* \details Todas as ordens rodam em O(V + E), exceto ordenações locais por grau (O(E log d)).
+*
+* \pre Snapshot válido.
+* \post Permutações completas de [0, V).
+*/
+
+#include "VertexOrdering.h"
+#include <algorithm>
+#include <cctype>
+#include <numeric>
+using namespace std;
+
+/**
+ * \brief BFS componente a componente.
+ * \pre `byDegree` ativa a variante Cuthill-McKee (raiz de grau mínimo, vizinhos por grau).
+ * \post Retorna a ordem de descoberta.
+ */
+static vector<int> breadthFirst(const GraphSnapshot& snap, bool byDegree) {
+    int n = snap.vertexCount();
+    const auto& ids = snap.neighborIds();
+    auto degree = [&](int v) { return snap.end(v) - snap.begin(v); };
+
+    vector<int> roots(static_cast<size_t>(n));
+    iota(roots.begin(), roots.end(), 0);
+    if (byDegree) stable_sort(roots.begin(), roots.end(), [&](int x, int y) { return degree(x) < degree(y); });
+
+    vector<int> order;
+    order.reserve(static_cast<size_t>(n));
+    vector<char> seen(static_cast<size_t>(n), 0);
+    vector<int> row;
+    for (int r : roots) {
+        if (seen[r]) continue;
+        seen[r] = 1;
+        order.push_back(r);
+        for (size_t h = order.size() - 1; h < order.size(); ++h) {
+            int x = order[h];
+            row.clear();
+            for (int i = snap.begin(x); i < snap.end(x); ++i) {
+                if (!seen[ids[i]]) {
+                    seen[ids[i]] = 1;
+                    row.push_back(ids[i]);
+                }
+            }
+            if (byDegree) stable_sort(row.begin(), row.end(), [&](int a, int b) { return degree(a) < degree(b); });
+            order.insert(order.end(), row.begin(), row.end());
+        }
+    }
+    return order;
+}
+
+vector<int> VertexOrdering::compute(const GraphSnapshot& snap, VertexOrder order) {
+    int n = snap.vertexCount();
+    vector<int> result;
+    switch (order) {
+    case VertexOrder::BFS:
+        return breadthFirst(snap, false);
+    case VertexOrder::RCM:
+        result = breadthFirst(snap, true);
+        reverse(result.begin(), result.end());
+        return result;
+    case VertexOrder::DEGREE:
+        result.resize(static_cast<size_t>(n));
+        iota(result.begin(), result.end(), 0);
+        stable_sort(result.begin(), result.end(), [&](int x, int y) {
+            return snap.end(x) - snap.begin(x) > snap.end(y) - snap.begin(y);
+        });
+        return result;
+    case VertexOrder::KEY:
+    default:
+        result.resize(static_cast<size_t>(n));
+        iota(result.begin(), result.end(), 0);
+        return result;
+    }
+}
+
+double VertexOrdering::meanEdgeSpan(const GraphSnapshot& snap, int* outBandwidth) {
+    const auto& ids = snap.neighborIds();
+    long double sum = 0;
+    size_t count = 0;
+    int band = 0;
+    for (int u = 0; u < snap.vertexCount(); ++u) {
+        for (int i = snap.begin(u); i < snap.end(u); ++i) {
+            if (ids[i] <= u) continue;
+            int span = ids[i] - u;
+            sum += span;
+            band = max(band, span);
+            ++count;
+        }
+    }
+    if (outBandwidth) *outBandwidth = band;
+    return count ? static_cast<double>(sum / count) : 0.0;
+}
+
+string VertexOrdering::name(VertexOrder order) {
+    switch (order) {
+    case VertexOrder::BFS: return "BFS";
+    case VertexOrder::RCM: return "RCM";
+    case VertexOrder::DEGREE: return "DEGREE";
+    case VertexOrder::KEY:
+    default: return "KEY";
+    }
+}
+
+bool VertexOrdering::parse(const string& text, VertexOrder& out) {
+    string t;
+    for (char c : text) t.push_back(static_cast<char>(toupper(static_cast<unsigned char>(c))));
+    for (VertexOrder o : {VertexOrder::KEY, VertexOrder::BFS, VertexOrder::RCM, VertexOrder::DEGREE}) {
+        if (name(o) == t) { out = o; return true; }
+    }
+    return false;
+}
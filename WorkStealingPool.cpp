@@ -0,0 +1,99 @@
+/**
+* @file WorkStealingPool.cpp
+* @authors
+*   Francisco Eduardo Fontenele - 15452569
+*   Vinicius Botte - 15522900
+*
+* \brief Implementação do pool de threads com roubo de tarefas.
+*
+* \details O dono consome a frente da própria fila; ladrões retiram do final de filas alheias.
+*
+* \pre Plataforma com suporte a `std::thread`.
+* \post Tarefas executadas em paralelo com balanceamento dinâmico.
+*/
+
+#include "WorkStealingPool.h"
+#include <utility>
+using namespace std;
+
+WorkStealingPool::WorkStealingPool(unsigned threads) {
+    if (threads == 0) threads = thread::hardware_concurrency();
+    if (threads == 0) threads = 1;
+    for (unsigned i = 0; i < threads; ++i) queues.push_back(make_unique<TaskQueue>());
+    for (unsigned i = 0; i < threads; ++i) workers.emplace_back(&WorkStealingPool::workerLoop, this, i);
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    wait();
+    {
+        lock_guard<mutex> lk(stateMutex);
+        stopping = true;
+    }
+    workCv.notify_all();
+    for (auto& t : workers) t.join();
+}
+
+void WorkStealingPool::submit(function<void()> task) {
+    unsigned id = nextQueue.fetch_add(1) % static_cast<unsigned>(queues.size());
+    {
+        lock_guard<mutex> lk(stateMutex);
+        {
+            lock_guard<mutex> qlk(queues[id]->m);
+            queues[id]->tasks.push_back(std::move(task));
+        }
+        ++queued;
+        ++pending;
+    }
+    workCv.notify_one();
+}
+
+void WorkStealingPool::wait() {
+    unique_lock<mutex> lk(stateMutex);
+    idleCv.wait(lk, [&] { return pending == 0; });
+}
+
+bool WorkStealingPool::tryTake(unsigned id, function<void()>& out) {
+    {
+        TaskQueue& own = *queues[id];
+        lock_guard<mutex> lk(own.m);
+        if (!own.tasks.empty()) {
+            out = std::move(own.tasks.front());
+            own.tasks.pop_front();
+            return true;
+        }
+    }
+    size_t n = queues.size();
+    for (size_t k = 1; k < n; ++k) {
+        TaskQueue& victim = *queues[(id + k) % n];
+        lock_guard<mutex> lk(victim.m);
+        if (!victim.tasks.empty()) {
+            out = std::move(victim.tasks.back());
+            victim.tasks.pop_back();
+            return true;
+        }
+    }
+    return false;
+}
+
+void WorkStealingPool::workerLoop(unsigned id) {
+    while (true) {
+        function<void()> task;
+        if (tryTake(id, task)) {
+            {
+                lock_guard<mutex> lk(stateMutex);
+                --queued;
+            }
+            task();
+            bool idle;
+            {
+                lock_guard<mutex> lk(stateMutex);
+                idle = (--pending == 0);
+            }
+            if (idle) idleCv.notify_all();
+            continue;
+        }
+        unique_lock<mutex> lk(stateMutex);
+        workCv.wait(lk, [&] { return stopping || queued > 0; });
+        if (stopping && queued == 0) return;
+    }
+}
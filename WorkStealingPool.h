@@ -0,0 +1,101 @@
+/**
+* @file WorkStealingPool.h
+* @authors
+*   Francisco Eduardo Fontenele - 15452569
+*   Vinicius Botte - 15522900
+*
+* \brief Pool de threads com roubo de tarefas (work-stealing).
+*
+* \details Cada worker possui sua própria fila; tarefas são distribuídas em rodízio e um worker
+*          ocioso rouba tarefas do final da fila de outro worker. A ordem de submissão é
+*          preservada dentro de cada fila, permitindo agendar tarefas maiores primeiro.
+*
+* \pre As tarefas submetidas não devem lançar exceções.
+* \post Todas as tarefas submetidas são executadas antes de `wait` retornar.
+*/
+
+#ifndef WORK_STEALING_POOL_H
+#define WORK_STEALING_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+using namespace std;
+
+class WorkStealingPool {
+private:
+    struct TaskQueue {
+        mutex m;
+        deque<function<void()>> tasks;
+    };
+
+    vector<unique_ptr<TaskQueue>> queues;
+    vector<thread> workers;
+    mutex stateMutex;
+    condition_variable workCv;
+    condition_variable idleCv;
+    size_t queued = 0;
+    size_t pending = 0;
+    bool stopping = false;
+    atomic<unsigned> nextQueue{0};
+
+    /**
+     * \brief Retira uma tarefa da própria fila ou rouba de outra.
+     * \pre `id` deve ser um índice de worker válido.
+     * \post Retorna verdadeiro e preenche `out` se alguma tarefa foi obtida.
+     */
+    bool tryTake(unsigned id, function<void()>& out);
+
+    /**
+     * \brief Laço principal de cada worker.
+     * \pre Chamado apenas pela thread do worker `id`.
+     * \post Retorna quando o pool é destruído.
+     */
+    void workerLoop(unsigned id);
+
+public:
+    /**
+     * \brief Cria o pool com o número de threads indicado.
+     * \pre `threads == 0` usa `thread::hardware_concurrency()`.
+     * \post Workers iniciados e aguardando tarefas.
+     */
+    explicit WorkStealingPool(unsigned threads = 0);
+
+    /**
+     * \brief Aguarda as tarefas pendentes e encerra os workers.
+     * \pre Nenhuma outra thread deve submeter tarefas durante a destruição.
+     * \post Todas as threads são finalizadas.
+     */
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    /**
+     * \brief Submete uma tarefa para execução assíncrona.
+     * \pre A tarefa deve ser autocontida ou sincronizar seus próprios dados.
+     * \post A tarefa é enfileirada na próxima fila em rodízio.
+     */
+    void submit(function<void()> task);
+
+    /**
+     * \brief Bloqueia até que todas as tarefas submetidas terminem.
+     * \pre Não deve ser chamado de dentro de uma tarefa do próprio pool.
+     * \post Nenhuma tarefa pendente ou em execução.
+     */
+    void wait();
+
+    /**
+     * \brief Retorna o número de workers.
+     * \pre O pool deve estar construído.
+     * \post Valor sempre maior que zero.
+     */
+    unsigned size() const { return static_cast<unsigned>(workers.size()); }
+};
+
+#endif
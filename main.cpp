@@ -16,11 +16,31 @@
 #include "Graph.h"
 #include "KruskalMST.h"
 #include "SimpleExporter.h"
+#include "MstPathIndex.h"
+#include "MstSensitivity.h"
+#include "SecondBestMST.h"
+#include "MstVerifier.h"
+#include "SteinerTree.h"
+#include "CompactGraphFormat.h"
+#include "VertexOrdering.h"
+#include "PhaseProfiler.h"
+#include "GeometricMST.h"
+#include "NetworkTopologyParser.h"
 #include <iostream>
+#include <chrono>
 #include <filesystem>
 #include <limits>
+#include <algorithm>
+#include <cstdlib>
 #include <fstream>
+#include <sstream>
 #include <string>
+#include <memory>
+#ifndef _WIN32
+#include "QueryServer.h"
+#include "PartitionedMST.h"
+#include <csignal>
+#endif
 using namespace std;
 
 /**
@@ -117,6 +137,22 @@ static void printGraphState(const Graph& graph) {
     graph.displayGraph();
 }
 
+/**
+ * \brief Calcula a MST e constrói o índice de gargalo sobre ela.
+ * \pre O grafo deve estar carregado.
+ * \post Retorna índice pronto para consultas de aresta máxima no caminho.
+ */
+static MstPathIndex buildPathIndex(const Graph& graph, KruskalMST& kruskal) {
+    auto snap = graph.snapshot();
+    vector<Edge> mst;
+    int total = 0;
+    kruskal.compute(*snap, mst, total);
+    return MstPathIndex(snap->getAllVertices(), mst);
+}
+
+/** \brief Maior opção válida do menu. */
+static constexpr int MENU_MAX = 23;
+
 /**
  * \brief Imprime o menu contínuo de operações.
  * \pre Saída padrão deve estar acessível.
@@ -135,27 +171,447 @@ static void printMenu() {
     cout << "7. Remover vertice\n";
     cout << "8. Remover aresta\n";
     cout << "9. Executar Kruskal (MST)\n";
-    cout << "10. Sair\n\n";
+    cout << "10. Sair\n";
+    cout << "11. Kruskal por componente (paralelo)\n";
+    cout << "12. Agrupar em k clusters (single-linkage)\n";
+    cout << "13. Consultar gargalo entre dois vertices (MST)\n";
+    cout << "14. Consultar gargalos em lote (arquivo de pares)\n";
+    cout << "15. Analise de sensibilidade das arestas\n";
+    cout << "16. Segunda melhor arvore geradora (reserva)\n";
+    cout << "17. Renumerar vertices (KEY, BFS, RCM, DEGREE)\n";
+    cout << "18. Verificar conectividade entre dois vertices\n";
+    cout << "19. MST geometrica (arquivo com VERTEX chave x y)\n";
+    cout << "20. Exportar grafo e MST em binario NumPy (.npy)\n";
+    cout << "21. Verificar MST de arquivo (certificado)\n";
+    cout << "22. Arvore de Steiner (conectar apenas terminais)\n";
+    cout << "23. MST particionada (processos de trabalho)\n\n";
+}
+
+/**
+ * \brief Grava cópia compacta (versão 2) do grafo e reporta a taxa de compressão.
+ * \pre Grafo carregado; caminho de saída gravável.
+ * \post Imprime tamanhos v1/v2, razão e tempos de codificação e decodificação.
+ */
+static int runPack(const Graph& graph, const string& outPath) {
+    using Clock = chrono::steady_clock;
+    auto snap = graph.snapshot();
+
+    auto t0 = Clock::now();
+    vector<uint8_t> body;
+    CompactGraphFormat::encode(*snap, body);
+    auto t1 = Clock::now();
+    map<string, list<pair<string, int>>> decoded;
+    bool ok = CompactGraphFormat::decode(body.data(), body.size(), decoded);
+    auto t2 = Clock::now();
+
+    if (!ok || decoded.size() != static_cast<size_t>(snap->vertexCount())) {
+        cout << "Falha na verificacao do formato compacto.\n";
+        return 1;
+    }
+    if (!graph.saveAs(outPath, Graph::VERSION_COMPACT)) {
+        cout << "Falha ao gravar " << outPath << "\n";
+        return 1;
+    }
+
+    size_t v1 = CompactGraphFormat::sizeV1(*snap);
+    size_t v2 = body.size() + 2 * sizeof(int);
+    cout << "Vertices: " << snap->vertexCount() << ", arestas: " << snap->edgeCount() << "\n";
+    cout << "Versao 1: " << v1 << " bytes\n";
+    cout << "Versao 2: " << v2 << " bytes (" << outPath << ")\n";
+    cout << "Razao v1/v2: " << (v2 ? static_cast<double>(v1) / static_cast<double>(v2) : 0.0) << "x\n";
+    cout << "Codificacao: " << chrono::duration<double, milli>(t1 - t0).count() << " ms, "
+         << "decodificacao: " << chrono::duration<double, milli>(t2 - t1).count() << " ms\n";
+    return 0;
+}
+
+/**
+ * \brief Compara as numerações de vértices no Kruskal sobre o grafo carregado.
+ * \pre Grafo carregado; `rounds >= 1`.
+ * \post Imprime, por ordem, tempo de renumeração, indicadores de localidade e tempos acumulados
+ *       das fases do Kruskal em `rounds` execuções.
+ */
+static int runOrderBench(const Graph& graph, int rounds) {
+    using Clock = chrono::steady_clock;
+    auto base = graph.snapshot();
+    cout << "Vertices: " << base->vertexCount() << ", arestas: " << base->edgeCount()
+         << ", rodadas: " << rounds << "\n";
+    int reference = -1;
+    for (VertexOrder o : {VertexOrder::KEY, VertexOrder::BFS, VertexOrder::RCM, VertexOrder::DEGREE}) {
+        auto t0 = Clock::now();
+        auto snap = base->permuted(VertexOrdering::compute(*base, o));
+        double permuteMs = chrono::duration<double, milli>(Clock::now() - t0).count();
+
+        PhaseProfiler profiler;
+        profiler.enableCounters();
+        int total = 0;
+        for (int r = 0; r < rounds; ++r) {
+            KruskalMST kruskal;
+            vector<Edge> mst;
+            PhaseScope phase(&profiler, "kruskal (total)");
+            kruskal.compute(*snap, mst, total, &profiler);
+        }
+        if (reference < 0) reference = total;
+
+        int band = 0;
+        double span = VertexOrdering::meanEdgeSpan(*snap, &band);
+        cout << VertexOrdering::name(o) << ": renumeracao " << permuteMs << " ms, distancia media " << span
+             << ", banda " << band << (total == reference ? "" : " (CUSTO DIVERGENTE)") << "\n";
+        profiler.print(cout);
+    }
+    return 0;
+}
+
+/**
+ * \brief Perfil por fase dos caminhos críticos, com contadores de hardware quando disponíveis.
+ * \pre `binPath` inicializado; `topology` vazio pula a fase de parse.
+ * \post Fases: parse do `.txt` (sem importar), carga de `graph.bin`, fases do Kruskal, exportação
+ *       de `graph_edges.txt`/`mst_edges.txt` e persistência ao destruir o grafo.
+ */
+static int runProfile(const filesystem::path& binPath, const string& topology) {
+    PhaseProfiler profiler;
+    string reason;
+    if (profiler.enableCounters(&reason)) {
+        cout << "Contadores de hardware:";
+        for (int k = 0; k < PerfCounters::COUNT; ++k) {
+            if (profiler.counters()->has(k)) cout << " " << PerfCounters::name(k);
+        }
+        cout << "\n";
+    } else {
+        cout << "Contadores de hardware indisponiveis (" << reason << "); apenas tempos.\n";
+    }
+
+    if (!topology.empty()) {
+        vector<string> vertices;
+        vector<Edge> edges;
+        PhaseScope phase(&profiler, "parse");
+        if (!NetworkTopologyParser::parse(topology, vertices, edges)) cout << "Topologia sem linhas validas: " << topology << "\n";
+    }
+    unique_ptr<Graph> graph;
+    {
+        PhaseScope phase(&profiler, "carga");
+        graph.reset(new Graph(binPath.string()));
+    }
+    auto snap = graph->snapshot();
+    KruskalMST kruskal;
+    vector<Edge> mst;
+    int total = 0;
+    {
+        PhaseScope phase(&profiler, "kruskal (total)");
+        kruskal.compute(*snap, mst, total, &profiler);
+    }
+    {
+        PhaseScope phase(&profiler, "exportacao");
+        SimpleExporter::exportEdges(*snap, "graph_edges.txt");
+        SimpleExporter::exportMst(mst, "mst_edges.txt");
+    }
+    cout << "Vertices: " << snap->vertexCount() << ", arestas: " << snap->edgeCount() << ", custo da MST: " << total << "\n";
+    snap.reset();
+    {
+        PhaseScope phase(&profiler, "persistencia");
+        graph.reset();
+    }
+    profiler.print(cout);
+    return 0;
+}
+
+/**
+ * \brief Verifica uma MST gravada em arquivo (linhas `u v w`, como `mst_edges.txt`).
+ * \pre `claimedCost < 0` usa a soma das arestas do arquivo como custo esperado.
+ * \post Imprime o resultado e retorna verdadeiro se a árvore for mínima.
+ */
+static bool verifyMstFile(const Graph& graph, const string& path, int claimedCost) {
+    ifstream in(path);
+    if (!in) {
+        cout << "Arquivo nao encontrado: " << path << "\n";
+        return false;
+    }
+    vector<Edge> candidate;
+    string a, b;
+    int w = 0, sum = 0;
+    while (in >> a >> b >> w) {
+        candidate.emplace_back(a, b, w);
+        sum += w;
+    }
+    auto t0 = chrono::steady_clock::now();
+    MstVerification result;
+    bool ok = MstVerifier::verify(graph, candidate, claimedCost < 0 ? sum : claimedCost, result);
+    double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+    cout << "Arestas: " << candidate.size() << ", custo " << result.computedCost << ", fora da arvore verificadas: "
+         << result.nonTreeChecked << " (" << ms << " ms)\n";
+    cout << (ok ? "Certificado: " : "Falha: ") << MstVerifier::describe(result.defect) << "\n";
+    if (!ok && result.defect != MstDefect::COST_MISMATCH) {
+        cout << "  " << result.witness.u() << " - " << result.witness.v() << " (" << result.witness.weight() << ")";
+        if (result.defect == MstDefect::NOT_MINIMUM) {
+            cout << " substitui " << result.heaviest.u() << " - " << result.heaviest.v() << " (" << result.heaviest.weight() << ")";
+        }
+        cout << "\n";
+    }
+    return ok;
+}
+
+/**
+ * \brief Calcula a árvore de Steiner aproximada dos terminais lidos de `in` (chaves separadas por espaço).
+ * \pre `printEdges` lista as arestas da árvore (menu); a CLI imprime só o resumo.
+ * \post Exporta a árvore em `outPath` (formato de `mst_edges.txt`) e retorna falso se houver chave
+ *       desconhecida ou custo acima de `int`.
+ */
+static bool computeSteiner(const Graph& graph, istream& in, const string& outPath, bool printEdges) {
+    vector<string> terminals;
+    string key;
+    while (in >> key) terminals.push_back(key);
+    auto t0 = chrono::steady_clock::now();
+    SteinerResult result;
+    if (!SteinerTree::compute(graph, terminals, result)) {
+        if (result.overflow) {
+            cout << "Custo da arvore excede o limite de int.\n";
+            return false;
+        }
+        cout << "Terminais inexistentes:";
+        for (const auto& k : result.missing) cout << " " << k;
+        cout << "\n";
+        return false;
+    }
+    double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+    if (printEdges) {
+        cout << "Arvore de Steiner\n";
+        cout << "-----------------\n";
+        for (const auto& e : result.tree) cout << e.u() << " - " << e.v() << " (" << e.weight() << ")\n";
+    }
+    cout << "Terminais: " << result.terminals << ", arestas do fecho: " << result.closureEdges
+         << ", custo da MST do fecho: " << result.closureCost << "\n";
+    if (result.components > 1) cout << "Grupos de terminais desconectados: " << result.components << "\n";
+    SimpleExporter::exportMst(result.tree, outPath);
+    cout << "Arestas: " << result.tree.size() << ", custo total: " << result.totalCost << " (" << ms
+         << " ms, " << outPath << ")\n";
+    return true;
+}
+
+/**
+ * \brief Executa Kruskal e exporta tabela de chaves, arestas e MST em `.npy`.
+ * \pre Diretório de execução gravável.
+ * \post Grava `graph_vertices.txt`, `graph_edges.npy` e `mst_edges.npy` da mesma versão do grafo.
+ */
+static bool exportBinary(const Graph& graph, KruskalMST& kruskal, bool wide) {
+    using Clock = chrono::steady_clock;
+    auto snap = graph.snapshot();
+    vector<Edge> mst;
+    int total = 0;
+    kruskal.compute(*snap, mst, total);
+
+    const string vPath = "graph_vertices.txt";
+    const string ePath = "graph_edges.npy";
+    const string mPath = "mst_edges.npy";
+    auto t0 = Clock::now();
+    bool ok = SimpleExporter::exportVertices(*snap, vPath)
+              && SimpleExporter::exportEdgesNpy(*snap, ePath, wide)
+              && SimpleExporter::exportMstNpy(*snap, mst, mPath, wide);
+    auto t1 = Clock::now();
+    if (!ok) {
+        cout << "Falha ao gravar os arquivos de exportacao.\n";
+        return false;
+    }
+    cout << "Exportados (" << (wide ? "int64" : "int32") << "): " << vPath << ", " << ePath << ", " << mPath
+         << " em " << chrono::duration<double, milli>(t1 - t0).count() << " ms\n";
+    cout << "MST: " << mst.size() << " arestas, custo total " << total << "\n";
+    return true;
+}
+
+/**
+ * \brief Lê os sítios com coordenadas e calcula a MST euclidiana.
+ * \pre Arquivo no formato de topologia com linhas `VERTEX chave x y`.
+ * \post Retorna falso se não houver ao menos dois sítios, se as distâncias não forem
+ *       representáveis ou se o custo total exceder `int`; imprime erros de leitura e estatísticas.
+ */
+static bool computeGeometricMst(const string& path, vector<Edge>& mst, int& total) {
+    using Clock = chrono::steady_clock;
+    vector<string> vertices;
+    vector<Edge> edges;
+    vector<string> errors;
+    vector<SiteCoord> sites;
+    auto t0 = Clock::now();
+    NetworkTopologyParser::parse(path, vertices, edges, &errors, &sites);
+    auto t1 = Clock::now();
+    for (size_t i = 0; i < errors.size() && i < 5; ++i) cout << errors[i] << "\n";
+    if (errors.size() > 5) cout << "... " << errors.size() - 5 << " erros omitidos\n";
+    if (sites.size() < 2) {
+        cout << "Sao necessarios ao menos dois vertices com coordenadas.\n";
+        return false;
+    }
+    GeometricStats stats;
+    if (!GeometricMST::compute(sites, mst, total, &stats)) {
+        if (stats.overflow) cout << "Custo da arvore excede o limite de int.\n";
+        else cout << "Coordenadas muito distantes: distancias fora do intervalo de double.\n";
+        return false;
+    }
+    auto t2 = Clock::now();
+    cout << "Sitios: " << sites.size() - stats.duplicateKeys;
+    if (stats.duplicateKeys) cout << " (" << stats.duplicateKeys << " chaves repetidas ignoradas)";
+    if (vertices.size() > sites.size()) cout << ", " << vertices.size() - sites.size() << " vertices sem coordenadas";
+    cout << "\nRodadas de Boruvka: " << stats.rounds << ", arestas candidatas: " << stats.candidates << "\n";
+    cout << "Leitura: " << chrono::duration<double, milli>(t1 - t0).count() << " ms, MST: "
+         << chrono::duration<double, milli>(t2 - t1).count() << " ms\n";
+    return true;
+}
+
+#ifndef _WIN32
+static QueryServer* activeServer = nullptr;
+
+/**
+ * \brief Tratador de SIGINT/SIGTERM do modo servidor.
+ * \pre Servidor ativo registrado em `activeServer`.
+ * \post Solicita parada; o grafo é persistido ao retornar de `main`.
+ */
+static void onStopSignal(int) {
+    if (activeServer) activeServer->stop();
+}
+
+/**
+ * \brief Executa o modo servidor mantendo o grafo residente.
+ * \pre Grafo carregado; caminho do socket gravável.
+ * \post Retorna código de saída após `SHUTDOWN` ou sinal de parada.
+ */
+static int runServer(Graph& graph, const string& socketPath) {
+    QueryServer server(graph, socketPath);
+    activeServer = &server;
+    signal(SIGINT, onStopSignal);
+    signal(SIGTERM, onStopSignal);
+    signal(SIGPIPE, SIG_IGN);
+    cout << "Servidor em " << socketPath << " (n = " << graph.snapshot()->vertexCount() << ")\n";
+    bool ok = server.run();
+    activeServer = nullptr;
+    if (!ok) {
+        cout << "Falha ao abrir socket: " << socketPath << "\n";
+        return 1;
+    }
+    cout << "Requisicoes atendidas: " << server.requestsServed() << "\n";
+    return 0;
 }
 
+/**
+ * \brief Imprime o resumo de uma execução particionada.
+ * \pre `stats` preenchido por `PartitionedMST::compute`.
+ * \post Uma linha com processos, volume enviado e tempos.
+ */
+static void printPartitionStats(const PartitionStats& stats, double totalMs) {
+    double mean = stats.workers > 0 ? static_cast<double>(stats.ownedEdges) / stats.workers : 0.0;
+    cout << "Processos: " << stats.workers << ", maior particao: " << stats.maxWorkerEdges << " arestas (media "
+         << mean << "), arestas enviadas: " << stats.edgesSent << " (" << stats.bytesSent
+         << " bytes), mais lento: " << stats.workerMs << " ms, juncao: " << stats.mergeMs << " ms, total: "
+         << totalMs << " ms";
+}
+
+/**
+ * \brief Compara a MST particionada com 1, 2, 4, ... processos contra o Kruskal em processo único.
+ * \pre `maxWorkers >= 1`.
+ * \post Retorna 1 se algum custo divergir do Kruskal.
+ */
+static int runPartitionBench(const Graph& graph, int maxWorkers) {
+    using Clock = chrono::steady_clock;
+    auto snap = graph.snapshot();
+    KruskalMST kruskal;
+    vector<Edge> mst;
+    int expected = 0;
+    auto t0 = Clock::now();
+    kruskal.compute(*snap, mst, expected);
+    double baseMs = chrono::duration<double, milli>(Clock::now() - t0).count();
+    cout << "Vertices: " << snap->vertexCount() << ", arestas: " << snap->edgeCount() << " ("
+         << snap->edgeCount() * sizeof(IdEdge) << " bytes como IdEdge)\n";
+    cout << "Kruskal em processo unico: " << baseMs << " ms, custo " << expected << "\n";
+
+    int mismatches = 0;
+    double firstMs = 0;
+    for (int workers = 1; workers <= maxWorkers; workers *= 2) {
+        PartitionStats stats;
+        int total = 0;
+        t0 = Clock::now();
+        if (!PartitionedMST::compute(*snap, workers, mst, total, &stats)) {
+            cout << "Falha ao criar processos (" << workers << ").\n";
+            return 1;
+        }
+        double ms = chrono::duration<double, milli>(Clock::now() - t0).count();
+        if (workers == 1) firstMs = ms;
+        printPartitionStats(stats, ms);
+        cout << ", speedup: " << (ms > 0 ? firstMs / ms : 0.0) << "x";
+        if (total != expected) {
+            cout << " (custo " << total << " difere)";
+            ++mismatches;
+        }
+        cout << "\n";
+    }
+    return mismatches == 0 ? 0 : 1;
+}
+#endif
+
 /**
  * \brief Ponto de entrada da aplicação CLI.
  * \pre Ambiente com C\+\+17, acesso a arquivos e diretórios de trabalho válido.
  * \post Executa loop de menu até opção de saída e persiste estado ao finalizar.
+ *       Com `--serve [socket]`, atende consultas por socket Unix em vez do menu;
+ *       com `--pack [saida.bin]`, grava cópia no formato compacto e reporta a compressão;
+ *       com `--bench-order [rodadas]`, compara as numerações de vértices no Kruskal;
+ *       com `--geo-mst arquivo [saida]`, calcula a MST euclidiana dos vértices com coordenadas;
+ *       com `--export-npy [32|64]`, exporta grafo e MST em `.npy` sem passar pelo menu;
+ *       com `--verify-mst [arquivo] [custo]`, verifica uma MST gravada (código 1 se inválida);
+ *       com `--steiner arquivo [saida]`, conecta apenas os terminais listados no arquivo;
+ *       com `--bench-partition [processos]`, mede a MST particionada entre processos;
+ *       com `--profile [topologia.txt]`, mede as fases com contadores de hardware (se houver).
  */
-int main() {
+int main(int argc, char* argv[]) {
     string binFile = "graph.bin";
     filesystem::path binPath = filesystem::current_path() / binFile;
 
+    if (argc >= 3 && string(argv[1]) == "--geo-mst") {
+        vector<Edge> mst;
+        int total = 0;
+        if (!computeGeometricMst(argv[2], mst, total)) return 1;
+        const string mPath = argc >= 4 ? argv[3] : "mst_edges.txt";
+        SimpleExporter::exportMst(mst, mPath);
+        cout << "Arestas: " << mst.size() << ", custo total: " << total << " (" << mPath << ")\n";
+        return 0;
+    }
+
     ensureBinaryInit(binPath);
 
+    if (argc >= 2 && string(argv[1]) == "--profile") {
+        return runProfile(binPath, argc >= 3 ? argv[2] : "");
+    }
+
     Graph graph(binPath.string());
     KruskalMST kruskal;
 
+    if (argc >= 2 && string(argv[1]) == "--bench-order") {
+        return runOrderBench(graph, argc >= 3 ? max(1, atoi(argv[2])) : 3);
+    }
+    if (argc >= 2 && string(argv[1]) == "--export-npy") {
+        return exportBinary(graph, kruskal, argc >= 3 && string(argv[2]) == "64") ? 0 : 1;
+    }
+    if (argc >= 2 && string(argv[1]) == "--verify-mst") {
+        return verifyMstFile(graph, argc >= 3 ? argv[2] : "mst_edges.txt", argc >= 4 ? atoi(argv[3]) : -1) ? 0 : 1;
+    }
+    if (argc >= 3 && string(argv[1]) == "--steiner") {
+        ifstream in(argv[2]);
+        if (!in) {
+            cout << "Arquivo nao encontrado: " << argv[2] << "\n";
+            return 1;
+        }
+        return computeSteiner(graph, in, argc >= 4 ? argv[3] : "steiner_edges.txt", false) ? 0 : 1;
+    }
+    if (argc >= 2 && string(argv[1]) == "--pack") {
+        return runPack(graph, argc >= 3 ? argv[2] : "graph.v2.bin");
+    }
+#ifndef _WIN32
+    if (argc >= 2 && string(argv[1]) == "--serve") {
+        return runServer(graph, argc >= 3 ? argv[2] : "kruskal.sock");
+    }
+    if (argc >= 2 && string(argv[1]) == "--bench-partition") {
+        return runPartitionBench(graph, argc >= 3 ? max(1, atoi(argv[2])) : 8);
+    }
+#endif
+
     while (true) {
         printGraphState(graph);
         printMenu();
-        int opt = readIntInRange("Escolha (0-10): ", 0, 10);
+        int opt = readIntInRange("Escolha (0-" + to_string(MENU_MAX) + "): ", 0, MENU_MAX);
 
         if (opt == 0) {
             graph.clearAndPersist();
@@ -212,9 +668,10 @@ int main() {
             graph.deleteUndirectedEdge(a, b);
             cout << "OK.\n\n";
         } else if (opt == 9) {
+            auto snap = graph.snapshot();
             vector<Edge> mst;
             int total = 0;
-            kruskal.compute(graph, mst, total);
+            kruskal.compute(*snap, mst, total);
             cout << "\nMST (Kruskal)\n";
             cout << "-------------\n";
             for (const auto& e : mst) {
@@ -225,12 +682,180 @@ int main() {
             const string vPath = "graph_vertices.txt";
             const string ePath = "graph_edges.txt";
             const string mPath = "mst_edges.txt";
-            SimpleExporter::exportVertices(graph, vPath);
-            SimpleExporter::exportEdges(graph, ePath);
+            SimpleExporter::exportVertices(*snap, vPath);
+            SimpleExporter::exportEdges(*snap, ePath);
             SimpleExporter::exportMst(mst, mPath);
             cout << "Exportados: " << vPath << ", " << ePath << ", " << mPath << "\n\n";
         } else if (opt == 10) {
             return 0;
+        } else if (opt == 11) {
+            vector<ComponentMST> components;
+            kruskal.computeByComponent(graph, components);
+            cout << "\nMST por componente (Kruskal)\n";
+            cout << "----------------------------\n";
+            int total = 0;
+            for (size_t i = 0; i < components.size(); ++i) {
+                const auto& c = components[i];
+                cout << "Componente " << (i + 1) << ": " << c.vertices.size() << " vertices, "
+                     << c.edges.size() << " arestas, custo " << c.totalCost << "\n";
+                for (const auto& e : c.edges) {
+                    cout << "  " << e.u() << " - " << e.v() << " (" << e.weight() << ")\n";
+                }
+                total += c.totalCost;
+            }
+            cout << "Componentes: " << components.size() << ", custo total: " << total << "\n";
+            vector<Edge> forest;
+            for (const auto& c : components) forest.insert(forest.end(), c.edges.begin(), c.edges.end());
+            MstVerification check;
+            MstVerifier::verify(graph, forest, total, check);
+            cout << "Certificado: " << MstVerifier::describe(check.defect) << "\n\n";
+        } else if (opt == 12) {
+            int k = readInt("\nNumero de clusters (k): ");
+            if (k < 1) { cout << "Invalido.\n\n"; continue; }
+            int limit = readInt("Custo maximo de ligacao (-1 = sem limite): ");
+            Clustering result;
+            if (limit < 0) kruskal.cluster(graph, k, result);
+            else kruskal.cluster(graph, k, result, limit);
+            cout << "\nClusters (single-linkage)\n";
+            cout << "-------------------------\n";
+            vector<vector<string>> members(static_cast<size_t>(result.clusterCount));
+            for (size_t i = 0; i < result.vertices.size(); ++i) {
+                members[static_cast<size_t>(result.cluster[i])].push_back(result.vertices[i]);
+            }
+            for (size_t c = 0; c < members.size(); ++c) {
+                cout << "Cluster " << (c + 1) << ":";
+                for (const auto& v : members[c]) cout << " " << v;
+                cout << "\n";
+            }
+            cout << "Clusters: " << result.clusterCount << ", arestas examinadas: " << result.edgesScanned << "\n\n";
+        } else if (opt == 13) {
+            string a = trim(readLine("\nPrimeiro vertice: "));
+            string b = trim(readLine("Segundo vertice: "));
+            if (a.empty() || b.empty()) { cout << "Invalido.\n\n"; continue; }
+            if (!graph.hasVertex(a) || !graph.hasVertex(b)) { cout << "Vertice inexistente.\n\n"; continue; }
+            MstPathIndex index = buildPathIndex(graph, kruskal);
+            const Edge* e = nullptr;
+            if (index.maxEdge(a, b, &e)) {
+                cout << "Gargalo: " << e->u() << " - " << e->v() << " (" << e->weight() << ")\n\n";
+            } else {
+                cout << "Sem caminho.\n\n";
+            }
+        } else if (opt == 14) {
+            string path = trim(readLine("\nArquivo de consultas (linhas \"A B\"): "));
+            ifstream in(path);
+            if (!in) { cout << "Arquivo nao encontrado.\n\n"; continue; }
+            vector<pair<string, string>> queries;
+            string a, b;
+            while (in >> a >> b) queries.emplace_back(a, b);
+            MstPathIndex index = buildPathIndex(graph, kruskal);
+            vector<int> weights;
+            index.queryBatch(queries, weights);
+            cout << "\nGargalos (MST)\n";
+            cout << "--------------\n";
+            for (size_t i = 0; i < queries.size(); ++i) {
+                cout << queries[i].first << " - " << queries[i].second << ": ";
+                if (weights[i] < 0) cout << "sem caminho\n";
+                else cout << weights[i] << "\n";
+            }
+            cout << "Consultas: " << queries.size() << "\n\n";
+        } else if (opt == 15) {
+            vector<EdgeSensitivity> report;
+            MstSensitivity::analyze(graph, report);
+            cout << "\nSensibilidade (MST)\n";
+            cout << "-------------------\n";
+            for (const auto& s : report) {
+                cout << s.edge.u() << " - " << s.edge.v() << " (" << s.edge.weight() << ") ";
+                if (s.inMst) {
+                    if (s.hasPartner) cout << "MST, substituta " << s.partner.u() << " - " << s.partner.v() << " (" << s.threshold << ")\n";
+                    else cout << "MST, ponte sem substituta\n";
+                } else {
+                    cout << "fora, entra abaixo de " << s.threshold << "\n";
+                }
+            }
+            const string sPath = "sensitivity.txt";
+            SimpleExporter::exportSensitivity(report, sPath);
+            cout << "Exportado: " << sPath << "\n\n";
+        } else if (opt == 16) {
+            vector<Edge> mst;
+            int total = 0;
+            kruskal.compute(graph, mst, total);
+            SecondBestResult second;
+            if (!SecondBestMST::compute(graph, mst, total, second)) {
+                cout << "\nMST unica: nao ha aresta fora da arvore.\n\n";
+                continue;
+            }
+            cout << "\nSegunda melhor arvore\n";
+            cout << "---------------------\n";
+            cout << "Sai:   " << second.removed.u() << " - " << second.removed.v() << " (" << second.removed.weight() << ")\n";
+            cout << "Entra: " << second.added.u() << " - " << second.added.v() << " (" << second.added.weight() << ")\n";
+            cout << "Custo total: " << second.totalCost << " (+" << second.delta << ")\n\n";
+        } else if (opt == 17) {
+            string name = trim(readLine("\nOrdem (KEY, BFS, RCM, DEGREE): "));
+            VertexOrder order;
+            if (!VertexOrdering::parse(name, order)) { cout << "Invalido.\n\n"; continue; }
+            graph.setVertexOrder(order);
+            int band = 0;
+            double span = VertexOrdering::meanEdgeSpan(*graph.snapshot(), &band);
+            cout << "Ordem " << VertexOrdering::name(order) << ": distancia media " << span
+                 << ", banda " << band << "\n\n";
+        } else if (opt == 18) {
+            string a = trim(readLine("\nPrimeiro vertice: "));
+            string b = trim(readLine("Segundo vertice: "));
+            if (a.empty() || b.empty()) { cout << "Invalido.\n\n"; continue; }
+            if (!graph.hasVertex(a) || !graph.hasVertex(b)) { cout << "Vertice inexistente.\n\n"; continue; }
+            auto links = graph.connectivity();
+            cout << (links->connected(a, b) ? "Conectados" : "Sem caminho") << " ("
+                 << links->componentCount() << " componentes)\n\n";
+        } else if (opt == 19) {
+            string path = trim(readLine("\nArquivo de topologia com coordenadas: "));
+            vector<Edge> mst;
+            int total = 0;
+            cout << "\n";
+            if (!computeGeometricMst(path, mst, total)) { cout << "\n"; continue; }
+            cout << "\nMST geometrica (Kruskal sobre candidatas)\n";
+            cout << "----------------------------------------\n";
+            for (const auto& e : mst) {
+                cout << e.u() << " - " << e.v() << " (" << e.weight() << ")\n";
+            }
+            cout << "Custo total: " << total << "\n";
+            const string mPath = "mst_edges.txt";
+            SimpleExporter::exportMst(mst, mPath);
+            cout << "Exportado: " << mPath << "\n\n";
+        } else if (opt == 20) {
+            string bits = trim(readLine("\nLargura dos inteiros (32 ou 64) [32]: "));
+            if (!bits.empty() && bits != "32" && bits != "64") { cout << "Invalido.\n\n"; continue; }
+            cout << "\n";
+            exportBinary(graph, kruskal, bits == "64");
+            cout << "\n";
+        } else if (opt == 21) {
+            string path = trim(readLine("\nArquivo da MST (vazio = mst_edges.txt): "));
+            string cost = trim(readLine("Custo esperado (vazio = soma do arquivo): "));
+            cout << "\n";
+            verifyMstFile(graph, path.empty() ? "mst_edges.txt" : path, cost.empty() ? -1 : atoi(cost.c_str()));
+            cout << "\n";
+        } else if (opt == 22) {
+            istringstream keys(readLine("\nTerminais (chaves separadas por espaco): "));
+            cout << "\n";
+            computeSteiner(graph, keys, "steiner_edges.txt", true);
+            cout << "\n";
+        } else if (opt == 23) {
+#ifndef _WIN32
+            int workers = readIntInRange("\nNumero de processos (1-64): ", 1, 64);
+            auto snap = graph.snapshot();
+            vector<Edge> mst;
+            int total = 0;
+            PartitionStats stats;
+            auto t0 = chrono::steady_clock::now();
+            if (!PartitionedMST::compute(*snap, workers, mst, total, &stats)) {
+                cout << "Falha ao criar processos.\n\n";
+                continue;
+            }
+            printPartitionStats(stats, chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count());
+            SimpleExporter::exportMst(mst, "mst_edges.txt");
+            cout << "\nArestas: " << mst.size() << ", custo total: " << total << " (mst_edges.txt)\n\n";
+#else
+            cout << "\nDisponivel apenas em sistemas POSIX.\n\n";
+#endif
         }
     }
 }
@@ -5,6 +5,8 @@ Visualização de grafo usando NetworkX/Matplotlib sem Graphviz.
 Uso:
   python visualize.py [saida.png|.svg] [base_dir]
 Se os arquivos não estiverem no base_dir, tenta automaticamente 'base_dir\cmake-build-debug'.
+Se houver `graph_edges.npy`/`mst_edges.npy` (opção 20 do menu ou `--export-npy`) mais recentes que os
+`.txt`, eles são mapeados em memória (NumPy) em vez de lidos linha a linha.
 """
 
 import os
@@ -12,13 +14,18 @@ import sys
 import networkx as nx
 import matplotlib.pyplot as plt
 
+try:
+    import numpy as np
+except ImportError:
+    np = None
+
 def resolve_paths(base_dir):
     candidates = [base_dir, os.path.join(base_dir, "cmake-build-debug")]
     for d in candidates:
         vp = os.path.join(d, "graph_vertices.txt")
         ep = os.path.join(d, "graph_edges.txt")
         mp = os.path.join(d, "mst_edges.txt")
-        if os.path.exists(ep):
+        if os.path.exists(ep) or os.path.exists(os.path.join(d, "graph_edges.npy")):
             return vp, ep, mp, d
     # report first candidate for clarity
     vp = os.path.join(candidates[0], "graph_vertices.txt")
@@ -48,6 +55,31 @@ def load_graph(vertices_path, edges_path):
                 G.add_edge(u, v, weight=wv)
     return G
 
+def binary_path(text_path):
+    """Retorna o `.npy` correspondente se NumPy estiver disponível e ele for o mais recente."""
+    npy_path = os.path.splitext(text_path)[0] + ".npy"
+    if np is None or not os.path.exists(npy_path):
+        return None
+    if os.path.exists(text_path) and os.path.getmtime(text_path) > os.path.getmtime(npy_path):
+        return None
+    return npy_path
+
+def load_keys(vertices_path):
+    """Tabela de chaves: a linha i é a chave do id i usado nos `.npy`."""
+    with open(vertices_path, "r", encoding="utf-8") as f:
+        return np.array([line.rstrip("\n") for line in f], dtype=object)
+
+def load_graph_npy(keys, edges_npy):
+    edges = np.load(edges_npy, mmap_mode="r")  # forma (3, E): u, v, custo
+    G = nx.Graph()
+    G.add_nodes_from(keys.tolist())
+    G.add_weighted_edges_from(zip(keys[edges[0]], keys[edges[1]], edges[2].tolist()))
+    return G
+
+def load_mst_npy(keys, mst_npy):
+    mst = np.load(mst_npy, mmap_mode="r")
+    return {tuple(sorted(p)) for p in zip(keys[mst[0]], keys[mst[1]])}
+
 def load_mst(mst_path):
     mst_edges = set()
     if os.path.exists(mst_path):
@@ -65,15 +97,21 @@ def main():
 
     vertices_path, edges_path, mst_path, used_dir = resolve_paths(base_dir)
 
-    for p in (vertices_path, edges_path):
-        if not os.path.exists(p):
-            print(f"Não encontrado: {p}")
-    if not os.path.exists(edges_path):
-        print(f"Dica: rode com base_dir onde o `.exe` gerou os arquivos, ex: 'C:\\Users\\eduar\\CLionProjects\\KruskalsMST\\cmake-build-debug'")
-        raise FileNotFoundError(f"Não encontrado: {edges_path}")
-
-    G = load_graph(vertices_path, edges_path)
-    mst_edges = load_mst(mst_path)
+    edges_npy = binary_path(edges_path) if os.path.exists(vertices_path) else None
+    if edges_npy:
+        keys = load_keys(vertices_path)
+        G = load_graph_npy(keys, edges_npy)
+        mst_npy = binary_path(mst_path)
+        mst_edges = load_mst_npy(keys, mst_npy) if mst_npy else load_mst(mst_path)
+    else:
+        for p in (vertices_path, edges_path):
+            if not os.path.exists(p):
+                print(f"Não encontrado: {p}")
+        if not os.path.exists(edges_path):
+            print(f"Dica: rode com base_dir onde o `.exe` gerou os arquivos, ex: 'C:\\Users\\eduar\\CLionProjects\\KruskalsMST\\cmake-build-debug'")
+            raise FileNotFoundError(f"Não encontrado: {edges_path}")
+        G = load_graph(vertices_path, edges_path)
+        mst_edges = load_mst(mst_path)
 
     pos = nx.spring_layout(G, seed=42)
     edge_labels = {(u, v): ("" if d.get("weight") is None else d.get("weight")) for u, v, d in G.edges(data=True)}